@@ -1,19 +1,12 @@
 #include <string>
 #include <string_view>
-#include <capabilities.hpp>
+#include <capabilityindex.hpp>
 #include "app.hpp"
 #include "resource.h"
 
 namespace priv {
 
-bool IsKnownCapabilityNames(std::wstring_view name) {
-  for (auto c : KnownCapabilityNames) {
-    if (name == c) {
-      return true;
-    }
-  }
-  return false;
-}
+bool IsKnownCapabilityNames(std::wstring_view name) { return IsKnownCapabilityName(name); }
 
 bool App::InitializeCapabilities() {
   ListView_SetExtendedListViewStyleEx(appx.hlview, LVS_EX_CHECKBOXES, LVS_EX_CHECKBOXES);
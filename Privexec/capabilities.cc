@@ -2,7 +2,7 @@
 #include <string_view>
 #include "app.hpp"
 #include "resource.h"
-#include <capabilities.hpp>
+#include <capabilityindex.hpp>
 
 /// SEE:
 /// https://github.com/googleprojectzero/sandbox-attacksurface-analysis-tools/blob/master/NtApiDotNet/SecurityCapabilities.cs
@@ -10,14 +10,7 @@
 // Add-Type -TypeDefinition $source
 
 namespace priv {
-bool IsKnownCapabilityNames(std::wstring_view name) {
-  for (auto c : KnownCapabilityNames) {
-    if (name == c) {
-      return true;
-    }
-  }
-  return false;
-}
+bool IsKnownCapabilityNames(std::wstring_view name) { return IsKnownCapabilityName(name); }
 
 bool App::InitializeCapabilities() {
   appcas.hlview = GetDlgItem(hWnd, IDL_APPCONTAINER_LISTVIEW);
@@ -0,0 +1,66 @@
+#ifndef PRIVEXEC_CAPABILITYINDEX_HPP
+#define PRIVEXEC_CAPABILITYINDEX_HPP
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include "capabilities.hpp"
+#include "capabilitymph.hpp"
+
+namespace priv {
+// KnownCapabilityNames lookups through a minimal perfect hash: the first hash picks a displacement from
+// KnownCapabilityDisplacements, a negative one encodes the index itself, otherwise it seeds a second mix whose slot in
+// KnownCapabilitySlots holds the index. Names compare
+// ASCII case-insensitively, like Windows capability names. Regenerate capabilitymph.hpp with capindex_bench --table
+// whenever KnownCapabilityNames changes, a stale table only turns lookups into misses.
+constexpr wchar_t capability_fold(wchar_t c) {
+  return c >= L'A' && c <= L'Z' ? static_cast<wchar_t>(c + (L'a' - L'A')) : c;
+}
+
+// FNV-1a over the folded UTF-16 code units
+constexpr uint32_t capability_hash(std::wstring_view name) {
+  uint32_t h = 0x811C9DC5U;
+  for (auto c : name) {
+    h ^= static_cast<uint32_t>(capability_fold(c));
+    h *= 0x01000193U;
+  }
+  return h;
+}
+
+// capability_mix derives the hash of one level from the name hash, the string is only walked once per lookup
+constexpr uint32_t capability_mix(uint32_t h, uint32_t seed) {
+  h ^= seed * 0x9E3779B1U;
+  h ^= h >> 16;
+  h *= 0x85EBCA6BU;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35U;
+  h ^= h >> 16;
+  return h;
+}
+
+constexpr bool capability_equal(std::wstring_view a, std::wstring_view b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); i++) {
+    if (capability_fold(a[i]) != capability_fold(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// LookupCapabilityIndex returns the index of name in KnownCapabilityNames, -1 when it is not a known capability
+constexpr ptrdiff_t LookupCapabilityIndex(std::wstring_view name) {
+  constexpr auto n = std::size(KnownCapabilityNames);
+  auto h = capability_hash(name);
+  auto d = KnownCapabilityDisplacements[capability_mix(h, 0) % std::size(KnownCapabilityDisplacements)];
+  auto slot = d < 0 ? 0 : capability_mix(h, static_cast<uint32_t>(d)) % std::size(KnownCapabilitySlots);
+  auto index = d < 0 ? static_cast<size_t>(-(d + 1)) : static_cast<size_t>(KnownCapabilitySlots[slot]);
+  return index < n && capability_equal(KnownCapabilityNames[index], name) ? static_cast<ptrdiff_t>(index) : -1;
+}
+
+constexpr bool IsKnownCapabilityName(std::wstring_view name) { return LookupCapabilityIndex(name) >= 0; }
+} // namespace priv
+
+#endif
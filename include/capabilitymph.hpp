@@ -0,0 +1,148 @@
+// Code generated by capindex_bench --table. DO NOT EDIT.
+#ifndef PRIVEXEC_CAPABILITYMPH_HPP
+#define PRIVEXEC_CAPABILITYMPH_HPP
+#include <cstdint>
+
+namespace priv {
+constexpr int32_t KnownCapabilityDisplacements[] = {
+    -56, 1, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0,
+    0, 1, 0, 0, 0, 1, 1, 0, -167, 0, -781, 0,
+    -448, 0, 0, 0, -878, -644, -594, -39, 0, -916, 1, 1,
+    0, -819, 0, -270, -385, 0, -460, -348, 0, 0, 1, -571,
+    1, -701, 0, -231, -69, 0, 0, 1, -528, -895, 0, -821,
+    0, 0, -150, 4, -186, 0, -7, -577, -304, 0, 0, 2,
+    -555, -542, 0, -536, 1, -676, 0, 0, -226, 2, -195, 0,
+    1, 2, -491, -726, 0, 0, 1, 4, -851, 0, 0, 1,
+    1, 0, 2, 1, -239, 1, -758, 4, 1, -867, 0, -877,
+    3, -556, 1, -682, 0, 0, 0, 0, 0, 0, 0, -510,
+    1, -274, 1, -818, 0, -873, 2, 0, 0, 0, -720, -190,
+    0, 1, 0, 2, -413, -157, 1, 0, -917, 0, -41, 2,
+    3, 0, 0, -633, 0, 0, -608, 2, -834, 3, 0, -462,
+    1, -389, -191, 0, 0, 0, 0, 0, 0, 1, -96, -281,
+    0, 0, -98, -171, 0, 3, -637, -645, 0, -287, -728, 1,
+    0, -761, 1, -30, 0, -568, -792, -330, -64, -693, -687, -263,
+    0, 3, 0, -78, 0, 0, 0, -445, -175, 1, 0, 9,
+    0, 0, 1, 0, -134, 1, -893, 1, 0, 8, -292, 5,
+    1, 6, 1, 0, -432, 0, 3, 0, 1, 0, 2, 0,
+    0, -576, 2, -94, 2, 0, -143, 0, 0, -646, -746, 0,
+    4, 0, -486, -101, -114, -708, 4, 1, 0, 1, -418, -807,
+    -70, 0, -325, -425, 1, 0, -40, -253, 0, 0, 0, -164,
+    0, -742, 1, -335, 1, 0, 0, 1, -768, -697, 4, -881,
+    3, 3, -91, 1, -775, 3, -277, -71, 0, 0, 1, -120,
+    -853, 1, 0, -879, 6, 0, 1, 0, -745, 0, 0, -647,
+    -361, 0, 1, -291, -207, 0, 5, 0, -722, -884, 0, 0,
+    0, -612, -285, 0, 0, -176, -192, -493, -95, 0, -618, -782,
+    -219, -906, 0, -165, -755, 0, -14, -443, -372, 0, 0, 0,
+    -662, 0, 0, 1, 0, 0, -428, 0, 3, 1, -43, -33,
+    0, -912, -108, -82, -630, -558, 0, 0, 0, -141, -865, -837,
+    -156, -129, 2, 0, 0, -298, -808, -716, 1, 0, -118, 0,
+    -308, 0, 0, 2, 3, 2, 1, 0, -12, -894, 3, 0,
+    0, 3, -846, 1, 1, -198, 0, 0, -319, -450, -405, -717,
+    0, -426, 0, 4, -619, -503, -97, 0, 1, 3, 0, 1,
+    2, -611, 0, 1, -318, 0, -882, -312, 0, -429, -759, -337,
+    -835, 4, -442, 1, 0, -409, 0, 0, 3, 1, 1, 0,
+    -707, -404, 6, 0, 1, -310, 0, 0, 14, 0, 1, -232,
+    0, 3, 0, -396, -718, -309, 0, -300, -857, 0, 2, 6,
+    0, 0, 0, -831, 0, 0, -778, 9, -663, -4, 0, -605,
+    -225, -430, 0, 0, 1, 1, -246, -540, -29, -241, -415, 0,
+    1, 0, 0, -261, 1, 5, 0, 5, -240, 0, -416, 0,
+    1, 0, -505, -836, -99, 0, 0, 0, 0, 2, -248, 12,
+    0, 0, -484, 0, -863, -321, -24, 2, -130, 2, -339, -369,
+    2, 3, -526, -421, -683, 0, 2, 2, 2, 0, 0, 3,
+    -266, -331, 0, -359, -532, 0, 0, 0, 0, 0, -816, -913,
+    1, -374, 0, -332, 1, 0, 2, 0, -545, -173, -799, 3,
+    2, 0, 4, -295, 0, 6, 0, -871, -457, 1, 0, 0,
+    0, 0, 2, 0, -410, -121, 0, 0, 1, 1, -632, 5,
+    0, 0, -677, 2, 0, 0, -525, 2, 0, 0, 6, -681,
+    -128, -45, 0, 7, -743, 1, -876, -856, 3, 0, -625, -406,
+    12, 0, 0, -80, -307, 0, 0, -216, 0, -220, -815, -688,
+    -59, 0, 0, -117, -710, 2, 3, 12, -48, 0, -26, -496,
+    -340, -700, 4, -222, -674, 2, 0, -830, 10, 0, 0, 10,
+    0, -653, -763, 1, -393, 3, 0, -196, -272, 0, -739, -794,
+    3, -631, -250, -237, -334, -55, -168, -327, 0, -787, -564, -591,
+    0, -570, 0, 1, -814, -453, 0, 0, 0, 0, -869, 0,
+    -598, -905, -504, -548, 0, -373, 1, -471, -346, 0, 5, 7,
+    -258, -864, -634, -679, 0, -65, -162, 3, -531, 2, -760, 0,
+    2, -227, -890, 2, -53, 0, -550, 2, 0, -719, 2, 0,
+    -181, 0, -691, -651, 0, 2, 11, 0, 0, 4, 10, -887,
+    -293, 1, -51, -412, 1, 1, 1, 0, -721, -61, 1, 1,
+    0, 0, 3, 3, -903, 0, 0, -604, 2, -793, -228, -452,
+    -859, 0, -844, 0, -626, 0, 5, -809, -627, -341, 3, 2,
+    -85, 0, -440, -855, -675, 0, 1, 0, 0, -805, 0, 2,
+    0, 0, 0, 6, -659, 5, -144, 1, 0, 0, -483, 7,
+    1, -602, 4, -236, 0, -800, -501, 0, 0, 0, 0, 0,
+    0, 0, -574, -534, 3, 0, 2, 0, -351, 1, -111, -131,
+    0, 0, 1, 2, 0, -796, 0, 1, -658, 0, 0, 6,
+    0, 1, 2, 0, 0, 0, 4, -142, 0, -279, 0, -146,
+    -11, -188, -466, -883, 0, -375, 0, 0, 0, 0, 6, -254,
+    -891, 0, -384, -587, -826, 0, -772, 0, 0, 0, 0, -265,
+    4, -352, -106, -804, -786, 5, 1, 0, 2, 0, -729, -302,
+    -810, 0, -163, 0, 8, 0, 4, -771, 0, 0, 0, 0,
+    -862, -223, 14, -838, 1, 8, 0, -559, -371, -813, 0, -858,
+    0, -797, -107, 0, 0, -521, -349, 5, 2, 3, 4, 0,
+    10, 2, 8, -27, -506, -539, -795, 0, 0, 0, -148, -690,
+    1, -751, 0, 5, 1,
+};
+constexpr uint16_t KnownCapabilitySlots[] = {
+    399, 36, 660, 508, 783, 89, 879, 694, 296, 139, 268, 31, 908, 0, 400, 0,
+    869, 0, 421, 899, 217, 0, 99, 0, 0, 778, 169, 523, 73, 0, 394, 248,
+    0, 134, 616, 0, 514, 669, 598, 0, 516, 48, 0, 176, 0, 455, 0, 641,
+    0, 0, 498, 440, 466, 398, 0, 768, 0, 647, 775, 0, 0, 0, 906, 0,
+    477, 220, 0, 494, 0, 580, 526, 0, 859, 578, 776, 0, 0, 486, 243, 606,
+    761, 454, 743, 83, 0, 559, 337, 619, 844, 246, 507, 0, 634, 0, 178, 805,
+    0, 0, 0, 842, 0, 312, 874, 422, 0, 0, 0, 0, 739, 0, 545, 698,
+    0, 602, 0, 623, 860, 0, 346, 0, 160, 0, 4, 203, 551, 708, 599, 0,
+    0, 0, 0, 518, 9, 0, 705, 0, 548, 592, 251, 0, 571, 587, 914, 0,
+    0, 0, 840, 581, 0, 0, 0, 583, 453, 0, 0, 0, 898, 0, 355, 0,
+    0, 729, 0, 735, 0, 0, 622, 732, 653, 0, 0, 0, 0, 532, 0, 397,
+    200, 556, 402, 0, 0, 801, 789, 600, 0, 283, 0, 457, 0, 561, 737, 57,
+    753, 572, 0, 2, 0, 92, 364, 193, 423, 0, 0, 0, 204, 118, 596, 270,
+    234, 0, 822, 229, 521, 0, 379, 287, 138, 640, 125, 33, 356, 0, 0, 666,
+    811, 685, 361, 313, 362, 0, 0, 419, 865, 755, 115, 584, 267, 0, 343, 201,
+    0, 553, 0, 0, 443, 488, 0, 321, 0, 281, 154, 511, 323, 0, 0, 895,
+    85, 0, 0, 851, 152, 608, 0, 0, 432, 0, 0, 0, 0, 0, 30, 144,
+    0, 512, 693, 0, 0, 171, 648, 0, 0, 66, 49, 907, 574, 45, 651, 614,
+    0, 295, 0, 0, 0, 0, 146, 663, 0, 332, 211, 819, 0, 0, 612, 0,
+    656, 711, 841, 873, 274, 501, 74, 82, 589, 0, 588, 891, 0, 0, 434, 0,
+    0, 51, 764, 763, 148, 123, 0, 0, 202, 319, 0, 16, 0, 0, 582, 0,
+    75, 0, 0, 15, 832, 0, 0, 259, 179, 0, 0, 560, 0, 0, 228, 0,
+    0, 391, 540, 0, 450, 352, 0, 378, 437, 0, 17, 621, 896, 342, 0, 0,
+    665, 0, 565, 101, 0, 0, 62, 853, 605, 396, 153, 198, 0, 0, 740, 0,
+    0, 109, 677, 0, 463, 481, 0, 0, 302, 478, 479, 748, 114, 827, 659, 328,
+    207, 731, 0, 35, 27, 474, 426, 467, 0, 34, 0, 0, 0, 0, 209, 0,
+    493, 366, 0, 0, 0, 304, 71, 192, 695, 0, 0, 165, 468, 464, 0, 0,
+    5, 188, 0, 0, 108, 0, 0, 733, 0, 782, 499, 519, 679, 0, 824, 0,
+    385, 577, 0, 900, 72, 579, 0, 381, 0, 0, 550, 0, 430, 480, 0, 0,
+    0, 0, 0, 670, 413, 0, 0, 46, 0, 0, 0, 418, 0, 327, 0, 0,
+    56, 542, 131, 184, 0, 472, 0, 0, 0, 473, 21, 0, 137, 199, 196, 0,
+    80, 594, 438, 515, 1, 0, 214, 655, 0, 887, 688, 168, 0, 0, 0, 0,
+    436, 712, 568, 458, 0, 0, 53, 0, 543, 376, 59, 0, 0, 0, 0, 784,
+    349, 363, 0, 672, 0, 177, 344, 536, 0, 839, 0, 0, 0, 186, 256, 897,
+    0, 0, 802, 0, 0, 0, 445, 0, 314, 0, 702, 210, 8, 462, 0, 847,
+    19, 671, 724, 0, 0, 87, 0, 407, 0, 14, 0, 0, 615, 150, 390, 0,
+    627, 885, 787, 67, 0, 24, 0, 0, 585, 779, 410, 233, 0, 497, 305, 790,
+    901, 277, 0, 0, 913, 0, 136, 747, 0, 401, 0, 469, 0, 609, 242, 121,
+    487, 884, 0, 0, 255, 0, 773, 0, 387, 0, 684, 0, 435, 272, 78, 0,
+    0, 157, 181, 322, 513, 546, 723, 909, 736, 734, 871, 0, 316, 151, 0, 0,
+    88, 12, 0, 821, 0, 697, 0, 552, 0, 43, 0, 831, 823, 65, 0, 205,
+    0, 510, 0, 0, 0, 816, 375, 0, 0, 0, 182, 341, 208, 0, 0, 751,
+    285, 377, 111, 0, 261, 797, 325, 0, 0, 0, 683, 0, 0, 867, 0, 0,
+    0, 354, 0, 537, 0, 595, 628, 0, 0, 0, 126, 0, 0, 664, 838, 0,
+    0, 635, 701, 642, 216, 0, 848, 112, 0, 37, 173, 654, 232, 91, 353, 0,
+    496, 335, 300, 310, 0, 476, 0, 0, 22, 460, 788, 0, 704, 0, 566, 223,
+    752, 0, 772, 416, 0, 0, 620, 0, 0, 0, 0, 18, 0, 369, 0, 0,
+    124, 517, 446, 703, 0, 0, 0, 668, 667, 102, 528, 0, 357, 0, 0, 0,
+    0, 0, 0, 448, 0, 158, 0, 0, 766, 691, 765, 132, 237, 0, 0, 746,
+    0, 649, 0, 0, 0, 135, 0, 0, 0, 0, 0, 386, 288, 0, 0, 0,
+    0, 0, 0, 389, 0, 159, 0, 298, 282, 637, 0, 484, 103, 0, 534, 241,
+    0, 86, 0, 183, 104, 433, 263, 0, 564, 315, 0, 367, 714, 0, 749, 0,
+    529, 20, 382, 471, 275, 0, 0, 0, 0, 365, 910, 849, 250, 0, 0, 0,
+    258, 244, 0, 293, 769, 0, 0, 506, 0, 0, 800, 393, 122, 61, 0, 846,
+    0, 359, 0, 726, 489, 0, 0, 0, 722, 0, 0, 0, 0, 0, 713, 0,
+    522, 730, 826, 903, 0, 266, 0, 0, 888, 475, 0, 591, 638, 491, 380, 0,
+    639, 828, 562, 254, 0, 279, 756, 76, 7, 710, 0, 810, 289, 406, 213, 0,
+    212, 613, 0, 41, 0,
+};
+} // namespace priv
+
+#endif
@@ -0,0 +1,929 @@
+// Code generated by capsid_test --table. DO NOT EDIT.
+#ifndef PRIVEXEC_CAPABILITYSIDS_HPP
+#define PRIVEXEC_CAPABILITYSIDS_HPP
+#include <cstdint>
+
+namespace priv {
+// KnownCapabilityRids[i] holds the capability hash of KnownCapabilityNames[i]
+constexpr uint32_t KnownCapabilityRids[][8] = {
+    {774208497U, 3724433823U, 2280098247U, 1267052767U, 1256890434U, 2028991070U, 3207881850U, 2803170042U}, // ID_CAP_ACCESSIBILITY_CLIENT
+    {4034606539U, 3852398287U, 1427559995U, 2694090195U, 2448273113U, 353852140U, 1809865592U, 2600500240U}, // ID_CAP_ACCESS_FAMILY_NOTES_API
+    {3579285253U, 486657032U, 2339407271U, 1097237001U, 449504006U, 450309546U, 3162681956U, 3486359964U}, // ID_CAP_ACCESS_REMINDER_IMAGES
+    {1950009213U, 936060211U, 4172343339U, 3246850340U, 3186610465U, 853341579U, 1335282943U, 1979374645U}, // ID_CAP_ACC_MGR_ADMIN
+    {479219474U, 2885956267U, 3095518087U, 1672553700U, 1388096776U, 1506847129U, 551921452U, 2537366653U}, // ID_CAP_ADAPTIVE_BRIGHTNESS_CONTROL
+    {2107512568U, 3225149457U, 3285279747U, 3063084584U, 464288558U, 2194022119U, 1392047761U, 1333630829U}, // ID_CAP_ADVERTISING_CONFIG
+    {1291817228U, 610580991U, 3780615219U, 543256413U, 1457574973U, 3662851358U, 3391846946U, 1480869071U}, // ID_CAP_AIS_TOKEN_MANAGER
+    {1785506828U, 2708045220U, 809329652U, 2677058173U, 1247703850U, 3684664803U, 2394966205U, 399964050U}, // ID_CAP_APPCONTAINER_PACKAGE_CERTIFICATES
+    {3143806525U, 1203864249U, 1421818192U, 3633341372U, 1897640038U, 385730927U, 2799706934U, 2446152123U}, // ID_CAP_APPOINTMENTS
+    {2368898550U, 2909701736U, 2311648875U, 2362607016U, 1412437129U, 1740687545U, 1969129245U, 1832168360U}, // ID_CAP_APPPREINSTALL_DIRECTORY
+    {1520186181U, 4105242225U, 2862429206U, 45244800U, 2487292187U, 1628964330U, 2775026264U, 1724778590U}, // ID_CAP_APPPREINSTALL_EVENTS
+    {3094623581U, 3144933562U, 3788420847U, 1528667299U, 1176901618U, 2584390066U, 311061140U, 3036856076U}, // ID_CAP_APPRESOLVER
+    {1173725387U, 2802302313U, 777589934U, 1957358426U, 967091676U, 138068922U, 4100040705U, 2806756745U}, // ID_CAP_APPX_EXECUTION
+    {2762723886U, 699437721U, 563337419U, 3485614415U, 3685218464U, 2719939591U, 1603517964U, 1123239774U}, // ID_CAP_APP_STORE_PURCHASE_HISTORY
+    {3566883707U, 2090469952U, 4000426518U, 2545929165U, 2736425139U, 3724057170U, 4055890952U, 748922986U}, // ID_CAP_AUDIO_EVENTSND
+    {3984113290U, 1951214720U, 295432403U, 3927478148U, 2117019826U, 1479021443U, 410720065U, 2782635805U}, // ID_CAP_AUDIO_INTERNAL
+    {1407847332U, 2225157494U, 2539225917U, 1407507193U, 2911240183U, 647879305U, 859002855U, 1914193657U}, // ID_CAP_AUDIO_ROUTING_CONTROLLER
+    {1497275846U, 4176677876U, 502210763U, 1484366811U, 246812187U, 868265464U, 3897222467U, 4279133868U}, // ID_CAP_AUDIO_SETTINGS
+    {55485814U, 2295463119U, 735945442U, 260437639U, 2010566355U, 3849876005U, 3889339505U, 502386160U}, // ID_CAP_AUTHHOST
+    {1780463809U, 2742525129U, 4082841646U, 3281504010U, 4127967651U, 1878430409U, 2403667859U, 2561806002U}, // ID_CAP_BACKGROUND_EXECUTION_MANAGEMENT
+    {2551391033U, 2827527651U, 4120476989U, 1282825331U, 2929669343U, 3031057253U, 4138841412U, 3417199028U}, // ID_CAP_BACKGROUND_SETTINGS_MANAGEMENT
+    {1741983003U, 3498682802U, 1664031165U, 975629034U, 1571979591U, 2899377402U, 3207487498U, 619052110U}, // ID_CAP_BACKGROUND_WORKER
+    {4082037088U, 4217120093U, 2308735545U, 2106322260U, 869813013U, 2589086500U, 590205673U, 3019284848U}, // ID_CAP_BACKUPROAMRESTORE
+    {679637434U, 3128451123U, 1167404577U, 3154959650U, 803474904U, 218218583U, 15891891U, 3838649586U}, // ID_CAP_BASEOS_UPDATEAPI
+    {532672612U, 2535533432U, 631466788U, 2911315649U, 3957057489U, 3698973828U, 872084021U, 3795439233U}, // ID_CAP_BINGCLIENT_BINGCONFIGURATION
+    {2654298321U, 3126663644U, 3465578781U, 3690022524U, 40210665U, 1128891521U, 1313141078U, 4062297563U}, // ID_CAP_BINGCLIENT_CA_INTERESTEXTRACTION
+    {439302105U, 3995225964U, 2197718367U, 2376906723U, 2991929506U, 1952713319U, 1066660296U, 1695714271U}, // ID_CAP_BINGCLIENT_DDC
+    {2618725217U, 1222280506U, 4132408283U, 564471669U, 1089507412U, 2925163453U, 1043056729U, 2693205124U}, // ID_CAP_BINGCLIENT_IDENTITY
+    {435944931U, 54420597U, 3338906200U, 3345479808U, 2456274549U, 4074872695U, 1761409988U, 188340225U}, // ID_CAP_BINGCLIENT_OSS
+    {2359426853U, 3165480374U, 3427303185U, 3421379290U, 1876759900U, 1634947527U, 1429429182U, 2467017213U}, // ID_CAP_BINGCLIENT_SUGGESTSHIGHLIGHTS
+    {3409176561U, 473512496U, 2812240848U, 2543312645U, 1800585963U, 2118549181U, 2489490965U, 3932591650U}, // ID_CAP_BINGCLIENT_TEE
+    {1580694559U, 2959402385U, 3771899359U, 3243404771U, 3956832714U, 1496846988U, 1783519482U, 1490354012U}, // ID_CAP_BLUETOOTH
+    {2364622686U, 1209598981U, 1314580344U, 87135040U, 2525187997U, 694429591U, 4168472881U, 1211665324U}, // ID_CAP_BLUETOOTH_ADMIN
+    {2693527334U, 1337007066U, 1883740003U, 1735309777U, 1406880000U, 2797140601U, 1201504069U, 710887520U}, // ID_CAP_BMR2_MONITOR_SERVICE
+    {1978150470U, 10096009U, 263378758U, 562195422U, 12847347U, 492548490U, 896560308U, 148888295U}, // ID_CAP_BMR_CONFIGURATION
+    {2229662683U, 3765844208U, 1904010406U, 4196972972U, 2965617636U, 1922668814U, 1713445599U, 820889161U}, // ID_CAP_BMR_SYNC
+    {2513931980U, 3380788110U, 1060404816U, 3186982467U, 3171498299U, 588903361U, 3695693470U, 1095960871U}, // ID_CAP_BROKER_NAVIGATION
+    {152858275U, 3945439053U, 3403198893U, 188157179U, 1305470982U, 1891534904U, 1554805694U, 34966059U}, // ID_CAP_BROWSER_ACCESSIBILITY_SETTINGS
+    {4265353158U, 1228794670U, 3447850780U, 1716427074U, 130500562U, 3904527144U, 1531709440U, 1055414426U}, // ID_CAP_BROWSER_FEATURE_CONTROL_KEYS
+    {2179963497U, 2968166932U, 3521883097U, 1866989665U, 3851457265U, 888987564U, 1195022228U, 3455095722U}, // ID_CAP_BSS_AIM_INTERFACE
+    {749309868U, 4081629156U, 1083044879U, 2036503106U, 2685033498U, 1583617464U, 3038022565U, 1252625419U}, // ID_CAP_BSS_NABSYNC_INTERFACE
+    {1794988709U, 521124326U, 3607759388U, 1839555998U, 2591476086U, 3110284630U, 2797442604U, 2763198506U}, // ID_CAP_BSS_PUSH_INTERFACE
+    {4153508582U, 4198885821U, 509135658U, 3207407925U, 49096855U, 2767364659U, 968676770U, 4033600652U}, // ID_CAP_BSS_REMINDER_INTERFACE
+    {1181148661U, 22499708U, 2470344036U, 931925202U, 2950179431U, 1000539013U, 3412595612U, 1574801768U}, // ID_CAP_BUILTIN_BASEPRIORITY
+    {3357019356U, 2961067734U, 2532854842U, 3419577255U, 4172991591U, 3155328790U, 3609120188U, 4283827966U}, // ID_CAP_BUILTIN_CREATEGLOBAL
+    {3326150854U, 4137902692U, 917304988U, 26626351U, 1360080517U, 1692660272U, 4035333147U, 2634461079U}, // ID_CAP_BUILTIN_CREATEPERMANENT
+    {2701977582U, 1536670721U, 438331367U, 874189579U, 75301735U, 3851249492U, 2561000152U, 2078707090U}, // ID_CAP_BUILTIN_DEFAULT
+    {429397116U, 1271375398U, 1449406447U, 1284198602U, 4047195577U, 279088506U, 1956681019U, 2532734761U}, // ID_CAP_BUILTIN_IMPERSONATE
+    {2044405903U, 271988726U, 2434661463U, 197560331U, 3723257092U, 1241225875U, 4017709341U, 1981091994U}, // ID_CAP_BUILTIN_PROFILE
+    {4209503679U, 2184748342U, 2834895087U, 1614851454U, 197222061U, 881709283U, 4263638572U, 2069438112U}, // ID_CAP_BUILTIN_SETTIME
+    {1756535202U, 1541376426U, 2541887379U, 543898708U, 1993746524U, 3896427000U, 2382021892U, 865238545U}, // ID_CAP_BUILTIN_SHUTDOWN
+    {1066260197U, 1356834439U, 3357501007U, 2618001302U, 3970141590U, 3532527633U, 3941847875U, 2576383025U}, // ID_CAP_BUILTIN_SYMBOLICLINK
+    {3469742348U, 3307254138U, 2238970105U, 3722559411U, 3372219397U, 2972199482U, 2833688915U, 1459669886U}, // ID_CAP_BUILTIN_TCB
+    {3313386555U, 1123182543U, 1317621395U, 2575484634U, 1423689632U, 1043279998U, 4225037970U, 3373142843U}, // ID_CAP_BUTTONS
+    {1451828072U, 3833841407U, 2487868269U, 1682516936U, 2971256151U, 3560914302U, 3988562740U, 770600926U}, // ID_CAP_CALLMESSAGING_FILTER
+    {978770360U, 120978706U, 370478463U, 3607821418U, 2899652023U, 1167433329U, 2132211847U, 2760562517U}, // ID_CAP_CAMERA
+    {448337351U, 1876666087U, 4192873654U, 1626907260U, 1353416210U, 3467321998U, 123075107U, 2965681553U}, // ID_CAP_CA_ACTIONURI_TEST_EVENT
+    {3612834734U, 30756299U, 1967518233U, 238853155U, 1154709274U, 4237082518U, 1438520316U, 845939314U}, // ID_CAP_CA_ADMIN
+    {2858115719U, 2690105117U, 1069316131U, 573108403U, 332108802U, 1340454167U, 2223975900U, 3354190050U}, // ID_CAP_CA_BACKGROUND_PROCESSOR
+    {3782025050U, 1647302113U, 2370086233U, 2063809792U, 820248190U, 3675929772U, 1752287697U, 700841558U}, // ID_CAP_CA_BACKGROUND_PROCESSOR_ADMIN
+    {367276224U, 1663220776U, 1797541150U, 2156458172U, 3327882143U, 3843035871U, 288351802U, 7587667U}, // ID_CAP_CA_CONTEXT
+    {2202497961U, 3866980025U, 1813944090U, 3581134618U, 3594422516U, 1482082306U, 295424382U, 1409227270U}, // ID_CAP_CA_DND_MANAGER
+    {2770947241U, 2548309330U, 4016079166U, 3155969074U, 3583215963U, 2305875380U, 1027304261U, 1019494965U}, // ID_CAP_CA_ENABLED
+    {2848768508U, 3825541055U, 2638714291U, 1589996885U, 1567941337U, 3744226842U, 1381518379U, 2837622372U}, // ID_CAP_CA_HISTORY
+    {959215011U, 3412900017U, 544875034U, 193879845U, 3506011039U, 2952254742U, 115735274U, 3531463173U}, // ID_CAP_CA_RULES
+    {4054145690U, 2982338618U, 1132615502U, 799412948U, 3260153009U, 115469652U, 3576881169U, 65623520U}, // ID_CAP_CA_SIGNALS_GENERIC
+    {2556164737U, 1708414419U, 443065478U, 530114444U, 3129782021U, 3314373326U, 492143000U, 1335852534U}, // ID_CAP_CA_SIGNALS_MANAGER
+    {59223725U, 3230630075U, 2973349639U, 2777015785U, 1640163886U, 4054965956U, 3679119211U, 4060977542U}, // ID_CAP_CA_SIGNALS_MANAGER_ADMIN
+    {1951404291U, 504935253U, 1396626343U, 1215703164U, 362839001U, 452165249U, 1565140029U, 2185492478U}, // ID_CAP_CA_UPLOAD_FOLDER
+    {1679065123U, 1721283697U, 1225774233U, 43142431U, 2129630509U, 1849699245U, 2914712325U, 1749964373U}, // ID_CAP_CELLUX_CONFIG_READ
+    {2803041463U, 1725003285U, 1956436409U, 1006166631U, 360273912U, 3247948615U, 893119137U, 4064144795U}, // ID_CAP_CELL_API_ADMIN
+    {712952650U, 1018556565U, 4166965235U, 2100616537U, 3656881935U, 2871598564U, 528382029U, 1858528910U}, // ID_CAP_CELL_API_COMMON
+    {4207553911U, 1817762215U, 3910401269U, 4171476381U, 2059234055U, 1375302801U, 3048877942U, 1871034040U}, // ID_CAP_CELL_API_LOCATION
+    {1390424552U, 1691338358U, 2576246362U, 1875410883U, 3946323183U, 1010518229U, 2157243190U, 3430877616U}, // ID_CAP_CELL_API_MESSAGING
+    {2832124402U, 3901469529U, 2407320272U, 3002914429U, 4108188867U, 4150506065U, 1712079598U, 1792979476U}, // ID_CAP_CELL_API_MODEMLOGGING
+    {2532104890U, 1144039736U, 4161170727U, 2796197587U, 3834497427U, 3804406954U, 1820288173U, 4083745594U}, // ID_CAP_CELL_API_OEM_PASSTHROUGH
+    {1055897915U, 1960384303U, 607641621U, 3024505513U, 157352144U, 47521771U, 3445903922U, 2731787806U}, // ID_CAP_CELL_API_TELEPHONY
+    {1142684182U, 2416172965U, 1570433021U, 2300812426U, 702579314U, 4123790801U, 1698860274U, 4119760252U}, // ID_CAP_CELL_API_UICC
+    {4044237190U, 1123927719U, 3336954744U, 352269214U, 3077346362U, 4208884923U, 2732909663U, 2268947172U}, // ID_CAP_CELL_API_UICC_LOWLEVEL
+    {1011430818U, 504156455U, 495266597U, 296451570U, 3607001594U, 3993194721U, 2992667838U, 3528562777U}, // ID_CAP_CELL_CELLMGR
+    {1662710934U, 4107732244U, 1716792499U, 2342878532U, 1814454919U, 3453377593U, 2393766285U, 3650167968U}, // ID_CAP_CELL_CMCSPWWAN_PLUS
+    {4288754362U, 3316631918U, 1416683637U, 798734870U, 1206362566U, 2951566787U, 1762360165U, 945464657U}, // ID_CAP_CELL_MSFT_UICC_DATASTORE
+    {1293099652U, 1545311409U, 3420187935U, 2306721718U, 4044725951U, 3918725199U, 3035268950U, 2961784272U}, // ID_CAP_CELL_OEM_UICC_DATASTORE
+    {2856872537U, 4175015198U, 2332593846U, 3669470251U, 3464949743U, 3365367046U, 3505357433U, 3554028318U}, // ID_CAP_CELL_RCSPRESENCE
+    {1559994394U, 1959683275U, 1549514529U, 3701899334U, 2514993386U, 1123522177U, 2207473709U, 2365152892U}, // ID_CAP_CELL_VIDEOTELEPHONY
+    {2231829592U, 2351861398U, 512327129U, 1827557680U, 1957081373U, 3041355704U, 2025819583U, 1412596825U}, // ID_CAP_CELL_WNF
+    {2282571734U, 394824064U, 4052628103U, 4076434356U, 475413489U, 3401166389U, 3997647808U, 2153845265U}, // ID_CAP_CELL_WNF_ADMIN
+    {1863506267U, 3852601845U, 1409170095U, 1814884997U, 1140501474U, 1069579054U, 2361145386U, 320494034U}, // ID_CAP_CELL_WNF_PII
+    {2146644134U, 2024455220U, 1284882637U, 2831036192U, 2508141528U, 4184327510U, 2674580988U, 2641125967U}, // ID_CAP_CHAMBER_PROFILE_CODE_INSTALLTEMP_RWD
+    {130999807U, 4161686417U, 1506270330U, 2761379233U, 360188501U, 790367969U, 3769759909U, 1329473333U}, // ID_CAP_CHAMBER_PROFILE_CODE_NITEMP_RW
+    {760839710U, 2499727841U, 2823183578U, 4284379333U, 3759118430U, 1440462302U, 2888334003U, 3474405188U}, // ID_CAP_CHAMBER_PROFILE_CODE_R
+    {1082845251U, 1271666872U, 1657514203U, 202760775U, 1683052000U, 2228060881U, 3229908919U, 4277100147U}, // ID_CAP_CHAMBER_PROFILE_CODE_RW
+    {3673267486U, 1624631328U, 3780745698U, 3083101337U, 2147515375U, 159379544U, 183356863U, 1893571485U}, // ID_CAP_CHAMBER_PROFILE_DATA_LIVETILES_RWD
+    {3446555215U, 2116936656U, 4025360356U, 1391670897U, 2494086073U, 3837975492U, 2825792617U, 2561959825U}, // ID_CAP_CHAMBER_PROFILE_DATA_MEDIA_RWD
+    {4068926054U, 953498713U, 112279193U, 1169636279U, 732685254U, 649374754U, 731607957U, 1094719338U}, // ID_CAP_CHAMBER_PROFILE_DATA_PLATFORMDATA_ALL
+    {209286841U, 806096319U, 346990515U, 1341445195U, 1612311295U, 1983720117U, 1968221581U, 2117969178U}, // ID_CAP_CHAMBER_PROFILE_DATA_R
+    {290842309U, 829523119U, 1542270326U, 1380981194U, 348398733U, 3560821538U, 3655423283U, 3640713896U}, // ID_CAP_CHAMBER_PROFILE_DATA_RW
+    {1652071953U, 392283240U, 3245432346U, 3922158446U, 2305877741U, 3919642795U, 1902202120U, 386425179U}, // ID_CAP_CHAMBER_PROFILE_DATA_SHELLCONTENT_R
+    {810264795U, 3383871660U, 3719408920U, 365764770U, 2418770429U, 1696445471U, 2788378125U, 3321511505U}, // ID_CAP_CHAMBER_PROFILE_DATA_SHELLCONTENT_RWD
+    {222844236U, 352667633U, 174289967U, 4257093873U, 1313571823U, 1841976787U, 3378976390U, 2573227038U}, // ID_CAP_CLIPBOARD
+    {3256124627U, 3810317426U, 1289640966U, 3240387748U, 3150113111U, 874408365U, 2462977246U, 2395127491U}, // ID_CAP_COMMANDCHANNEL
+    {1058646221U, 1183543647U, 2392987849U, 1892576843U, 3102671259U, 2476554530U, 385957336U, 3795885151U}, // ID_CAP_COMMS_APPLICATIONS
+    {958069687U, 2287469568U, 2224753988U, 1576311305U, 2481697567U, 2467831222U, 1365457947U, 1367821625U}, // ID_CAP_COMMS_COMMON
+    {3389991906U, 3378251674U, 2462981191U, 3444717786U, 4076244086U, 4214765756U, 1099135658U, 3374345300U}, // ID_CAP_COMMS_SERVICES
+    {2108243982U, 4111216374U, 2698154246U, 543354630U, 440637545U, 1266287597U, 4226678196U, 3622450172U}, // ID_CAP_COMMS_SETTINGS
+    {1197171996U, 1180401634U, 863664575U, 1500363675U, 265870253U, 3312865253U, 308402948U, 872443910U}, // ID_CAP_CONTACTS
+    {1927887678U, 486748875U, 3175723770U, 3033794450U, 1133866179U, 1587462665U, 1579896495U, 3707033231U}, // ID_CAP_CONTENTSHARING
+    {1173506711U, 2330812073U, 493000098U, 3487738017U, 2690907467U, 838571177U, 3077079861U, 3568139547U}, // ID_CAP_CORTANA_RULES_DB
+    {1443056127U, 1295755577U, 1017491144U, 1684624860U, 97926465U, 2048979871U, 166773580U, 1762370867U}, // ID_CAP_CREATE_PROCESS_IN_CHAMBER
+    {248168713U, 1396508272U, 3611549221U, 3895905881U, 1413340024U, 3837678032U, 1841449369U, 890846513U}, // ID_CAP_CREDENTIAL_COLLECTION_UI
+    {138363809U, 3467088U, 1490215246U, 587520221U, 1793178322U, 2493211141U, 3269190374U, 2695746050U}, // ID_CAP_CRITICAL_DATA
+    {2954823967U, 1070973611U, 3115288494U, 1657493556U, 1118044130U, 3628346031U, 3558862584U, 3571426833U}, // ID_CAP_CSP_BMR_PROVISION
+    {332167875U, 1987229510U, 2155973060U, 4197885389U, 2557206516U, 3565524291U, 4199577024U, 1508571988U}, // ID_CAP_CSP_DMCLIENT
+    {3962685180U, 2727725489U, 1431031852U, 2008534362U, 1444577716U, 1123901425U, 2142846841U, 2140214728U}, // ID_CAP_CSP_FOUNDATION
+    {414058345U, 1567702652U, 2123242003U, 1184004469U, 1239901273U, 162919860U, 1899731930U, 1037055215U}, // ID_CAP_CSP_LOCATION
+    {2074114630U, 43164284U, 3897716515U, 2849770325U, 4236841356U, 3347585675U, 27537832U, 3423802682U}, // ID_CAP_CSP_MAIL
+    {1817452701U, 2791420327U, 2147259100U, 2427997475U, 1013553902U, 1158036212U, 2248568046U, 1548551427U}, // ID_CAP_CSP_NODECACHE
+    {4148803163U, 4222635583U, 3650302675U, 772522717U, 1888208462U, 337264360U, 108366612U, 3255716077U}, // ID_CAP_CSP_OEM
+    {1252078408U, 1235448904U, 3611794438U, 402533519U, 233538133U, 905155232U, 517208258U, 2165556586U}, // ID_CAP_CSP_PHONE
+    {771369014U, 2513237227U, 1020759731U, 403978089U, 4128290342U, 4224802253U, 1695118744U, 2068837445U}, // ID_CAP_CSP_W4_APPLICATION
+    {1761694984U, 3912493281U, 1861110515U, 878234316U, 2619819446U, 3144417484U, 438739344U, 2061860810U}, // ID_CAP_CSP_WIFI_HOTSPOT
+    {3924836869U, 2402652201U, 917751304U, 2195433838U, 527715606U, 501985156U, 3022072383U, 502617940U}, // ID_CAP_DATACOLLECTION_ACTIVITY
+    {3861360422U, 3747984805U, 2526703588U, 3139918551U, 3843580662U, 2644649359U, 3887668524U, 3974780753U}, // ID_CAP_DATACOLLECTION_COLLECTOR
+    {2688760231U, 3723009682U, 2246147497U, 2638749555U, 1371528447U, 603967105U, 532615831U, 1890968348U}, // ID_CAP_DATACOLLECTION_RAWETW
+    {809918879U, 3266368437U, 1032700330U, 4059202277U, 1287781095U, 322135617U, 2724141017U, 3164731245U}, // ID_CAP_DATAPLANUSAGE
+    {4164502307U, 472739483U, 2012792192U, 485056344U, 3049938215U, 3872781645U, 2769192755U, 3736333899U}, // ID_CAP_DATAPLANUSAGE_ADMIN
+    {1212681987U, 3261125259U, 1288304779U, 959287455U, 3456885356U, 894705911U, 3613934734U, 2257627486U}, // ID_CAP_DCP
+    {4124136541U, 3153762127U, 1995690476U, 2520270420U, 1733563741U, 1220593188U, 2070907279U, 92460020U}, // ID_CAP_DEBUG
+    {2334113612U, 2399514642U, 934278562U, 796768778U, 3716544688U, 125856520U, 684501636U, 973439742U}, // ID_CAP_DEBUG_FOLDERS
+    {3255960977U, 3884914884U, 2503084951U, 1927402358U, 2683065496U, 2192479232U, 837259997U, 1888831111U}, // ID_CAP_DEBUG_NAVIGATION
+    {2489250862U, 3731101856U, 757172019U, 2830005102U, 2903107461U, 2549818383U, 1921265406U, 345878668U}, // ID_CAP_DEVELOPERUNLOCK
+    {435026874U, 574125424U, 2562811554U, 2720811615U, 3432479418U, 1962428897U, 4127210868U, 641492088U}, // ID_CAP_DEVELOPERUNLOCK_API
+    {2499537368U, 280841756U, 309285745U, 1864881169U, 1548990357U, 1104000173U, 362454985U, 3042039205U}, // ID_CAP_DEVELOPERUNLOCK_CODEDUI
+    {1489831172U, 3244057183U, 1355226266U, 2620099493U, 1119665031U, 4229374708U, 3428460220U, 288589085U}, // ID_CAP_DEVICE_LOCK
+    {1239508518U, 2238973216U, 3807685320U, 1092683601U, 713720309U, 4144038406U, 3673310705U, 586043027U}, // ID_CAP_DEVICE_LOCK_ADMIN
+    {2228988914U, 1158933111U, 610973818U, 3842313431U, 3370586393U, 3655460759U, 2764951963U, 2319834171U}, // ID_CAP_DEVICE_MANAGEMENT
+    {2155373409U, 2588654755U, 3485356470U, 3792173750U, 3253731926U, 2855594029U, 1916234755U, 4233411287U}, // ID_CAP_DEVICE_MANAGEMENT_ADMIN
+    {1328671235U, 350676372U, 4116672234U, 162651118U, 748707714U, 3181081022U, 2309470168U, 3270492729U}, // ID_CAP_DEVICE_MANAGEMENT_BOOTSTRAP
+    {1964422670U, 2805317472U, 2342955854U, 3804864184U, 3183813567U, 4062829734U, 3944473842U, 3339738272U}, // ID_CAP_DEVICE_MANAGEMENT_SECURITY_POLICIES
+    {1379664725U, 2008455863U, 758815057U, 1406777863U, 3082387944U, 488339782U, 3210944971U, 4086137459U}, // ID_CAP_DIAGNOSTIC_CLIENT
+    {2480063834U, 169439344U, 49649540U, 687616893U, 1042058597U, 1212544839U, 3006004344U, 88034819U}, // ID_CAP_DISPLAY_CONTROL
+    {976733580U, 2223430783U, 2526734031U, 2536390451U, 33293082U, 1916709982U, 1878906195U, 543786063U}, // ID_CAP_DMCLIENT_APPMGMT
+    {685409917U, 1960778880U, 2661502165U, 1243528365U, 3712556246U, 383787831U, 4205420744U, 1235633388U}, // ID_CAP_DO_NOT_DISTURB
+    {118476523U, 1560294579U, 1523501274U, 533019312U, 3677284674U, 2916650447U, 543332398U, 2461112060U}, // ID_CAP_DRIVE_MODE_ADMIN
+    {3014337281U, 3076985269U, 2306973044U, 931956108U, 1654243562U, 1528310509U, 3874019897U, 2265632643U}, // ID_CAP_DUASVC
+    {2531874001U, 4195569115U, 1037263328U, 4149345804U, 1095754468U, 4107092350U, 4233463U, 3469999000U}, // ID_CAP_DU_AGENT
+    {1226953425U, 3419189512U, 3223653583U, 1347440823U, 3119245460U, 2794704593U, 2920336145U, 1823471725U}, // ID_CAP_DU_CORE_API
+    {2214225167U, 3330007875U, 629360422U, 3050574468U, 1464325285U, 1869819653U, 2258590376U, 1960021788U}, // ID_CAP_DU_CSP
+    {1451293913U, 2682386164U, 1698168141U, 507782222U, 1261213888U, 3428560876U, 2362614729U, 796567568U}, // ID_CAP_DU_MIGRATION_MANAGER_STATUS
+    {784231915U, 1165677272U, 3126119956U, 3469223958U, 894119068U, 2636790375U, 948156418U, 4061084044U}, // ID_CAP_DU_MIGRATION_WNF_EVENTS
+    {1803325392U, 1198559281U, 2792641443U, 4096426005U, 950982541U, 3858215606U, 1016569512U, 3952164362U}, // ID_CAP_DU_MIGRATOR_PROVISIONING_STATUS_MICROSOFT
+    {2996827300U, 423150910U, 1944581438U, 935479097U, 2914241558U, 772285636U, 1545424803U, 2981458854U}, // ID_CAP_DU_MIGRATOR_PROVISIONING_STATUS_OEM
+    {847915132U, 3397513221U, 2729164747U, 661030598U, 2229682356U, 2736855220U, 3175867399U, 1073982662U}, // ID_CAP_DU_MIGRATOR_STATUS_MICROSOFT
+    {1519675861U, 2437020546U, 1615672005U, 647331025U, 902022321U, 3878165358U, 289944754U, 3198462634U}, // ID_CAP_DU_MIGRATOR_STATUS_OEM
+    {18617438U, 3852555694U, 615306130U, 3253026272U, 2048140001U, 1944573627U, 2413547685U, 2470068587U}, // ID_CAP_DU_PROVISIONING
+    {255531134U, 2625125579U, 3847820191U, 1331643250U, 2281001489U, 4033983812U, 1313350698U, 2181535199U}, // ID_CAP_DU_SHARED_DATA
+    {3410625515U, 1897376185U, 2271064583U, 2692904646U, 3543270832U, 3287988002U, 2757857819U, 1512463620U}, // ID_CAP_DU_USS
+    {2203255898U, 671293067U, 536297485U, 3631363548U, 2248610747U, 2997346404U, 3626990492U, 3282168510U}, // ID_CAP_DU_UX
+    {1240962295U, 1066817092U, 382400508U, 111070999U, 3644175079U, 2796254822U, 2992821092U, 3665506769U}, // ID_CAP_DU_UX_FEATURE_DISCOVERY
+    {3314012467U, 548991937U, 3239568731U, 3627493128U, 309556088U, 3389531339U, 100475702U, 2195576633U}, // ID_CAP_EAS_CREDENTIALS
+    {1560490093U, 3150263679U, 3913073905U, 493218528U, 1217089098U, 3525877903U, 1094563869U, 3290915522U}, // ID_CAP_EDM_CACHE_RWDELETE
+    {3600665919U, 2363766130U, 3622485169U, 2660972934U, 2570866048U, 1280798460U, 4214171462U, 2231352199U}, // ID_CAP_EDM_CACHE_WRITE
+    {180657347U, 122741296U, 4180725554U, 3164626001U, 398111854U, 1243558791U, 1608794046U, 395299256U}, // ID_CAP_ENDPOINTDISCOVERY
+    {3008406548U, 3193339295U, 1251318144U, 3954455267U, 3334506038U, 1529522549U, 1458996898U, 2362216182U}, // ID_CAP_ENROLLMENT
+    {849533162U, 3606139354U, 920253203U, 3521488610U, 4067001817U, 2836320569U, 628689121U, 4067438904U}, // ID_CAP_ENROLLMENT_ADMIN
+    {1219577130U, 94837940U, 4021897505U, 2542399292U, 149408625U, 4230882943U, 598849806U, 3414254126U}, // ID_CAP_ENROLLMENT_POLL
+    {1066792675U, 1856752121U, 448263667U, 183492887U, 2384563306U, 190501776U, 2027390660U, 2623264803U}, // ID_CAP_ENROLLMENT_RENEW
+    {3545864811U, 1630256340U, 3708683831U, 891538989U, 1829828887U, 1735606505U, 351795614U, 2246489594U}, // ID_CAP_ENTERPRISERESOURCESTORE
+    {2565089908U, 3235485705U, 3531660385U, 2422532460U, 2509806275U, 3383142038U, 151746435U, 3208414149U}, // ID_CAP_ENTERPRISE_AUTHENTICATION
+    {744342384U, 171107169U, 3300840640U, 3661608118U, 1718901758U, 2019771437U, 2988664388U, 1285509149U}, // ID_CAP_ENTERPRISE_ENROLLMENT
+    {2915258276U, 1983216279U, 3932826278U, 2679152272U, 3008442640U, 1290338783U, 2673756690U, 218180599U}, // ID_CAP_ENTERPRISE_SERVICE
+    {620567821U, 737739306U, 169290276U, 3267440968U, 3369811615U, 2277188922U, 284744457U, 2472170725U}, // ID_CAP_ENTERPRISE_SHARED_DATA
+    {286988506U, 3024496329U, 1242029813U, 1489639228U, 4118076720U, 3312578029U, 1950888325U, 3262055617U}, // ID_CAP_ETW_PROFILER
+    {3625662137U, 2682091254U, 856171984U, 2868379045U, 3001028726U, 1009205972U, 4175949866U, 684286152U}, // ID_CAP_EVERYONE
+    {1455060294U, 2006611718U, 1394859594U, 1785343116U, 982899002U, 3021835531U, 2553697285U, 1415319556U}, // ID_CAP_EVERYONE_INROM
+    {2902951254U, 1797683809U, 212196379U, 3580678323U, 4090286333U, 519029020U, 2280042480U, 4265124335U}, // ID_CAP_EXTERNAL_DISPLAY
+    {2128461642U, 3036957772U, 2339447430U, 62716173U, 3211901513U, 102092477U, 1795471829U, 3600068674U}, // ID_CAP_FAILURE_REPORT_CONTENT_PROVIDER
+    {3695219931U, 660708132U, 2934828679U, 1584772490U, 4250982312U, 345006032U, 1319211406U, 2159038307U}, // ID_CAP_FINDMYPHONE
+    {1516636972U, 4002063081U, 3519513159U, 4121188293U, 2993883606U, 1826224279U, 276807110U, 2856712331U}, // ID_CAP_FOREGROUND_TASK_MANAGER
+    {1872380395U, 2394361243U, 3570888592U, 3826462484U, 53510525U, 1115525068U, 1082957871U, 3617547939U}, // ID_CAP_GAMERSERVICES
+    {2034345757U, 2366417288U, 1978395495U, 338449883U, 4149174378U, 2073426543U, 324039589U, 2688632710U}, // ID_CAP_GLOBALIZATION_SETTINGS
+    {2947865464U, 3707630253U, 1836471950U, 3892478024U, 484581425U, 2237510785U, 3513261613U, 2086455247U}, // ID_CAP_HTTP_ACCEPT_LANGUAGE_HEADER
+    {3370394368U, 3817654550U, 1919658829U, 3274896815U, 2391583585U, 3783478911U, 1164931198U, 2338837334U}, // ID_CAP_ICS_RO
+    {2376854566U, 714973910U, 1571250757U, 2327293875U, 1093179939U, 177522618U, 3998750142U, 2013394283U}, // ID_CAP_ICS_RW
+    {3429164866U, 2191917383U, 213833408U, 991824664U, 198389277U, 3980030541U, 4112569327U, 2473651841U}, // ID_CAP_IDENTITY_DEVICE
+    {168874820U, 4035925987U, 1866170320U, 4055887615U, 2101277113U, 1306559416U, 2689441767U, 3305189688U}, // ID_CAP_IDENTITY_DEVICE_1ST_PARTY
+    {2460573504U, 1107513584U, 874306478U, 1530161711U, 981307678U, 1044080339U, 874738631U, 1612604526U}, // ID_CAP_IDENTITY_USER
+    {1416632374U, 3152971308U, 3633238730U, 2124956326U, 2422158797U, 1274540462U, 2007697920U, 257886977U}, // ID_CAP_IDENTITY_USER_1ST_PARTY
+    {618155720U, 2268190192U, 758728301U, 3788533235U, 2325132483U, 1298638933U, 1897612795U, 1138920060U}, // ID_CAP_IDM_IMAGE_CACHE
+    {2430522714U, 2303381836U, 3993576826U, 1394744092U, 1889838422U, 4211954870U, 2677099355U, 3219218595U}, // ID_CAP_IMMERSIVE_SHELL
+    {1233963979U, 3604205921U, 783019062U, 2710191449U, 448176888U, 3593028319U, 2099797817U, 2075145449U}, // ID_CAP_INPUT_CORE
+    {3262710851U, 1710859767U, 2737508763U, 3495686296U, 640998709U, 1991764799U, 2766712646U, 1250801225U}, // ID_CAP_INPUT_FEATURES
+    {1035056073U, 1733005359U, 1519077546U, 1086916186U, 2279488988U, 2183739572U, 220941870U, 1919561933U}, // ID_CAP_INPUT_INJECTION
+    {1101397092U, 2440240829U, 3797790566U, 4209785274U, 2009480717U, 948395056U, 1229586094U, 215337311U}, // ID_CAP_INPUT_LOCALES
+    {3352920935U, 867635778U, 712737162U, 1784698022U, 3870224835U, 2806424464U, 9011912U, 2570127640U}, // ID_CAP_INPUT_SERVICE
+    {3082507980U, 3684210319U, 2652201932U, 3690136872U, 602693295U, 4058059558U, 2202901681U, 3741552030U}, // ID_CAP_INSTALL_CERTIFICATES
+    {980967807U, 3836891893U, 323676848U, 3003869716U, 2276576678U, 2034561973U, 2078281271U, 3587510752U}, // ID_CAP_INTENTTEXTRACTION_OPTIN
+    {910556621U, 3497303107U, 1591549455U, 558772794U, 2771772607U, 83600851U, 3078711426U, 1008145493U}, // ID_CAP_INTERNAL_DEPLOYMENT
+    {215216260U, 2541310576U, 1871977666U, 2482418043U, 3551962778U, 764791109U, 430462217U, 2133980401U}, // ID_CAP_INTERNET_EXPLORER_BROWSER_HISTORY
+    {2512033128U, 1934371329U, 1396917299U, 602712499U, 2118838388U, 3662193539U, 1816711069U, 891295454U}, // ID_CAP_INTERNET_EXPLORER_DATA_OPTIMIZATION
+    {167496267U, 3773424399U, 418724309U, 3678360354U, 2720289775U, 3317683410U, 1531689842U, 3812883038U}, // ID_CAP_INTERNET_EXPLORER_FAVORITES
+    {2684667327U, 3122140483U, 2021074168U, 1405552287U, 3551959018U, 4245185083U, 761018022U, 1374931399U}, // ID_CAP_INTERNET_EXPLORER_HKCU_WRITE
+    {1064255300U, 3705235173U, 3265537868U, 2561867353U, 104214424U, 1331983388U, 269160328U, 2424223790U}, // ID_CAP_INTERNET_EXPLORER_HKLM_SECURITY_SETTINGS
+    {2296493237U, 4207573705U, 3065918245U, 3944155167U, 1056189801U, 4048482375U, 4148527376U, 654950682U}, // ID_CAP_INTERNET_EXPLORER_INTRANET_ZONE_SETTINGS
+    {909491541U, 1327750333U, 4143730011U, 2825595118U, 97896828U, 602374609U, 2956890295U, 2044876867U}, // ID_CAP_INTERNET_EXPLORER_REMOTEDEBUGGING
+    {4040839448U, 4059499125U, 3846365656U, 3092493563U, 3782258769U, 333365809U, 3738708540U, 2579162281U}, // ID_CAP_INTERNET_EXPLORER_ROAMING
+    {3396939252U, 3037638781U, 2203719402U, 1477295694U, 1589261024U, 2068350459U, 968012281U, 1053905080U}, // ID_CAP_INTERNET_EXPLORER_SEARCH_PROVIDER_KEYS_HKCU
+    {3924064082U, 2900048707U, 2201890956U, 2645363950U, 3844151028U, 2141764874U, 1227579062U, 1245366485U}, // ID_CAP_INTEROPSERVICES
+    {3574683068U, 1752226521U, 1155147068U, 583173471U, 3187734153U, 2008299352U, 2522859398U, 1938523291U}, // ID_CAP_ISV_CAMERA
+    {3836501916U, 2568089871U, 1148191526U, 173975558U, 164723197U, 2491679206U, 4003055065U, 1321685210U}, // ID_CAP_KEYBOARD
+    {1937517091U, 3370629626U, 2246338551U, 3730719320U, 3997315828U, 1084494683U, 3015107921U, 2901759513U}, // ID_CAP_KIDZONE_ADMIN
+    {1723508240U, 2717850342U, 382424384U, 164802953U, 1173124549U, 428953726U, 1413907134U, 2523362012U}, // ID_CAP_KIDZONE_CUSTOMIZATION
+    {3813515617U, 2756186739U, 2213645134U, 3995971687U, 2051712450U, 695732763U, 3203113883U, 1226727160U}, // ID_CAP_LANGUAGEUNDERSTANDING
+    {3401703828U, 4223757080U, 1281354830U, 248557279U, 3329705698U, 1725461822U, 3631041432U, 1785263900U}, // ID_CAP_LASS_ADMIN
+    {981966782U, 1720752150U, 3221052612U, 3446074739U, 381423383U, 3175214235U, 505805607U, 964401029U}, // ID_CAP_LASS_REMOTELOCK
+    {186728904U, 1248966709U, 2837533813U, 4151748619U, 1438224980U, 3453962350U, 1184454379U, 1550029409U}, // ID_CAP_LEGACY_VOICEMAIL_HANDLER
+    {1264160392U, 3247308276U, 12820063U, 458595013U, 2768734661U, 1421984703U, 2613230271U, 777289288U}, // ID_CAP_LEXICONUPDATE
+    {4205469904U, 3955512119U, 1921840463U, 2315182984U, 307650067U, 690880892U, 3528877815U, 4066519405U}, // ID_CAP_LIVEID
+    {3197155618U, 1476057154U, 996217435U, 565093570U, 1900910048U, 2888369104U, 1558542099U, 3514376177U}, // ID_CAP_LIVETOKEN_WNF_EVENTS
+    {2158456844U, 3754929254U, 744589270U, 3611187126U, 2481208986U, 30837703U, 3416168463U, 2437063433U}, // ID_CAP_LOCATION
+    {3842824567U, 178914259U, 466740046U, 159386189U, 4235713590U, 3349026085U, 1947878110U, 3889710422U}, // ID_CAP_LOCATION_ADMIN
+    {1354734771U, 155420121U, 3897373361U, 3752280624U, 978827147U, 3248344458U, 2231583132U, 1173781009U}, // ID_CAP_LOCATION_BTPOLICY
+    {247686312U, 1620689180U, 1764687748U, 4038688570U, 52657645U, 1378966326U, 1794119530U, 4209451477U}, // ID_CAP_LOCATION_GNSSDRIVER
+    {2170369038U, 2364263206U, 3644932994U, 2881238354U, 652065972U, 571287047U, 4120350065U, 3877263117U}, // ID_CAP_MAP
+    {190440352U, 439155184U, 4282510597U, 406381981U, 2309681896U, 1385846260U, 2368095517U, 2056010090U}, // ID_CAP_MAP_ADMIN
+    {2275930499U, 3802028574U, 1447246862U, 156004382U, 3908323893U, 3618243178U, 2076838221U, 2612873139U}, // ID_CAP_MAP_WRITE
+    {2994109957U, 4202701374U, 210186623U, 1877066336U, 3921449257U, 878208989U, 1344179568U, 3804437724U}, // ID_CAP_MEDIALIB
+    {1829253335U, 2916852241U, 1691201532U, 2042887584U, 3082970389U, 2581791321U, 2654304389U, 1137601773U}, // ID_CAP_MEDIALIB_AUDIO
+    {3656842009U, 737305612U, 962701380U, 725461182U, 1973642844U, 651574988U, 229186158U, 3868155400U}, // ID_CAP_MEDIALIB_INT
+    {3774042465U, 3895949944U, 2763861358U, 2371489234U, 2970034413U, 4106687434U, 1108259975U, 3402584636U}, // ID_CAP_MEDIALIB_PHOTO
+    {340549587U, 319435834U, 2626276056U, 321901470U, 621689951U, 4197727772U, 3605247457U, 3248652731U}, // ID_CAP_MEDIALIB_PHOTO_FULL
+    {3048910823U, 215476441U, 393023149U, 2072296119U, 2376215360U, 537725869U, 1269244064U, 386967405U}, // ID_CAP_MEDIALIB_PLAYBACK
+    {3373296908U, 2411484724U, 3515767462U, 947765668U, 3509355982U, 3670830776U, 3890152790U, 1465475484U}, // ID_CAP_MEDIALIB_VIDEO
+    {3645416969U, 1011500028U, 2073745651U, 1538258254U, 1988792832U, 559144643U, 404630243U, 1406387951U}, // ID_CAP_MEDIASERVICE_VOLUMELIMIT_INT
+    {476603989U, 259620494U, 892947199U, 2401694451U, 1301517928U, 3928814315U, 1586620433U, 1692557618U}, // ID_CAP_MICMUTEPOLICY_BYPASS
+    {927943109U, 13579301U, 3264376126U, 717908401U, 1136080082U, 1546768108U, 382930956U, 2230590623U}, // ID_CAP_MICROPHONE
+    {463525949U, 3729825856U, 3721196555U, 1834767050U, 1067004685U, 3688468005U, 502025504U, 3138201405U}, // ID_CAP_MONITOR_NAVIGATION
+    {3009341472U, 91027001U, 896432746U, 1588442292U, 4198615671U, 3544974328U, 2153679188U, 2970467515U}, // ID_CAP_MOUSE
+    {573494862U, 852034305U, 3966313457U, 4224520700U, 510758616U, 3440425295U, 640747520U, 1074373680U}, // ID_CAP_MO_CLOUDMESSAGING
+    {1817041610U, 1357507976U, 1922323357U, 3631384676U, 1861098856U, 3413700130U, 528239895U, 2660034030U}, // ID_CAP_MSS_BYTESTREAM_RPC
+    {1662860686U, 2816204406U, 2911754083U, 3516156014U, 1995804603U, 1363387103U, 2936568884U, 3601232708U}, // ID_CAP_MULTIMEDIA_ENCODER_HARDWARE
+    {2170476733U, 2975702239U, 2586780612U, 1387577921U, 3676160382U, 3040881160U, 4185834788U, 1301956967U}, // ID_CAP_MULTIVARIANT
+    {3149549929U, 3972215291U, 2780813207U, 1878560769U, 3866535526U, 2700445554U, 3348068313U, 1081718229U}, // ID_CAP_MULTIVARIANT_INSTALL_DATA
+    {3573991055U, 3390900411U, 2902283275U, 2596561414U, 438799178U, 3294465257U, 1220183201U, 288271875U}, // ID_CAP_NARRATOR_SETTINGS
+    {3251777039U, 978424543U, 1177289640U, 593613892U, 4088880775U, 1000623787U, 1546748207U, 1192316703U}, // ID_CAP_NATIVE_NETWORK_REPLACEMENT
+    {2677381221U, 2364199280U, 75434427U, 4027356186U, 3931609390U, 171686425U, 1692581318U, 3596168183U}, // ID_CAP_NAVIGATIONBAR_ADMIN
+    {138645281U, 2108396503U, 3422487579U, 2819378634U, 2394291191U, 1702401616U, 2644146957U, 3035521095U}, // ID_CAP_NETWORKING
+    {3513569483U, 3574884580U, 2264482402U, 1036786788U, 2626686027U, 1491812377U, 1593087649U, 4159331373U}, // ID_CAP_NETWORKING_ADMIN
+    {2829306766U, 4112427273U, 2220422607U, 4222497197U, 2605065597U, 1514279654U, 4134446667U, 545936211U}, // ID_CAP_NETWORKING_INTERNET_CLIENT
+    {525014453U, 2813097422U, 4141608865U, 2528114376U, 676196975U, 2122114356U, 2529573448U, 40745366U}, // ID_CAP_NETWORKING_INTERNET_CLIENT_SERVER
+    {1430229515U, 1253603003U, 4160494546U, 4108025832U, 3485602219U, 3429995982U, 321895001U, 3881966585U}, // ID_CAP_NETWORKING_PRIVATE_NETWORK_CLIENT_SERVER
+    {2402180121U, 4188564863U, 1108428934U, 2917162313U, 3356156168U, 563273755U, 3500347936U, 713065434U}, // ID_CAP_NETWORKING_VPN_ADMIN
+    {2579400809U, 3867311217U, 3984994116U, 908665914U, 3508570097U, 1336497314U, 873935804U, 1444405236U}, // ID_CAP_NETWORKING_VPN_PROVIDER
+    {1793611161U, 574360918U, 2777701736U, 773189098U, 3605514996U, 2754194708U, 3865425388U, 2767375059U}, // ID_CAP_NETWORKING_VPN_SERVICES
+    {3523166394U, 57408359U, 2383958183U, 3147263783U, 1336643290U, 347002375U, 2636801930U, 1129988835U}, // ID_CAP_NFC_ADMIN
+    {4067107036U, 2026004423U, 1492954149U, 391728022U, 1437832288U, 2094538104U, 818650315U, 1611581509U}, // ID_CAP_NOCENTER_SOUNDS
+    {1262420712U, 2639779015U, 994701577U, 2179912347U, 972350065U, 251047734U, 1848752318U, 2372844867U}, // ID_CAP_NTSERVICES
+    {1707525735U, 3206815453U, 1112114967U, 48267877U, 1887687392U, 2051739574U, 2847046674U, 867112312U}, // ID_CAP_NVREAD
+    {366053087U, 1602002883U, 4042181830U, 3743824562U, 3607022702U, 3824804250U, 710359348U, 3399734679U}, // ID_CAP_NVREADWRITE
+    {810132407U, 95717014U, 1476393367U, 4020883739U, 3911322142U, 2429325099U, 2744200121U, 3604556736U}, // ID_CAP_O365_DISCOVERY
+    {3965197257U, 261382818U, 3459785493U, 2444674519U, 2854280670U, 4221822968U, 408757942U, 640176997U}, // ID_CAP_OEMPUBLICDIRECTORY
+    {2622277354U, 1768194988U, 622092707U, 3347898202U, 2105816107U, 1605862553U, 2861187806U, 2412770845U}, // ID_CAP_OEM_ADC
+    {1893194748U, 4220550178U, 2702675942U, 3564749320U, 3271398048U, 3617688994U, 1131699573U, 2458832566U}, // ID_CAP_OEM_CUSTOM
+    {2958768839U, 3411888887U, 2065171532U, 2969248120U, 4109516085U, 1754713048U, 1134839755U, 2233678777U}, // ID_CAP_OEM_DEPLOYMENT
+    {2681780456U, 3661254415U, 1111940113U, 3201886886U, 4164730186U, 831959241U, 946560143U, 266930336U}, // ID_CAP_OFFICE_LAUNCH_URL
+    {991313912U, 243902482U, 2624699540U, 651706158U, 961580552U, 379012443U, 3180448065U, 2066896413U}, // ID_CAP_OFFICE_MSDRM_HKCU
+    {2744103101U, 942172209U, 4204088677U, 2593947019U, 4267115091U, 862081063U, 2467439316U, 1062170560U}, // ID_CAP_ONENOTE_EVENTS
+    {10023765U, 417243959U, 2585496365U, 3037374631U, 2965961089U, 3867533075U, 299706992U, 2663072434U}, // ID_CAP_OOBE_PRIVATE
+    {1630993814U, 601217366U, 903566270U, 3529248719U, 3990361547U, 3941825027U, 936573278U, 1183785738U}, // ID_CAP_ORIENTATION_LOCK
+    {2421359858U, 3292800717U, 3937629970U, 3049994222U, 3691635694U, 3595213639U, 179172308U, 78328930U}, // ID_CAP_PEOPLE_EXTENSION
+    {4185227476U, 2246489478U, 1464636475U, 3416398756U, 3533541569U, 3173998654U, 3158821001U, 470107728U}, // ID_CAP_PEOPLE_EXTENSION_IM
+    {2280369771U, 2439432829U, 1174820939U, 1673344414U, 3168890416U, 2607322881U, 4109686021U, 2067514948U}, // ID_CAP_PEOPLE_EXTENSION_MOBILE
+    {3044633684U, 1094154820U, 641776766U, 3206503115U, 3208609276U, 3010845640U, 2241800283U, 29677926U}, // ID_CAP_PERSONA
+    {3926762833U, 421792154U, 4182368412U, 1167398560U, 818829333U, 3084791552U, 909703691U, 1584206034U}, // ID_CAP_PERSONAL_INFORMATION_IMPORT
+    {2880013976U, 3013249434U, 3701006845U, 3957710220U, 2516263994U, 2304668363U, 2924680743U, 2314558444U}, // ID_CAP_PHONEBROKER_INTERFACE
+    {1093051720U, 1435832445U, 1091505747U, 4020695147U, 1904106210U, 3945710135U, 4255842428U, 2069462530U}, // ID_CAP_PHONEDIALER
+    {126634387U, 1552200377U, 327233840U, 2341745319U, 787995398U, 2519970009U, 2850909541U, 3876257800U}, // ID_CAP_PHONEPROVISIONER_DEVICEUPDATE
+    {2288109483U, 1680818662U, 1617236802U, 1540498286U, 1306607810U, 2558363936U, 2786130659U, 3267337389U}, // ID_CAP_PHONEPROVISIONER_EVENTS
+    {3539339505U, 4226243241U, 1267420962U, 3819397169U, 973464497U, 2001788315U, 3187428551U, 3777857644U}, // ID_CAP_PHONE_2ND_PARTY
+    {1509579144U, 1616414286U, 290831441U, 2323766643U, 3889076878U, 48906937U, 637641166U, 1631524129U}, // ID_CAP_PHONE_ADMIN
+    {1877490659U, 2995451574U, 242579634U, 3901418043U, 4200316299U, 1201490034U, 3298011999U, 1066557961U}, // ID_CAP_PHONE_INTERNAL
+    {3654571537U, 456459843U, 2727816309U, 1720595288U, 664930815U, 729242382U, 2022569960U, 256878772U}, // ID_CAP_PHOTOS_SETTINGS_R
+    {383474558U, 1982092961U, 748857719U, 12167853U, 1239771986U, 1556659075U, 196182164U, 184136384U}, // ID_CAP_PHOTOS_SETTINGS_RW
+    {3533679592U, 508845088U, 4147158362U, 2209834534U, 780686853U, 2990759422U, 3012222503U, 3512449943U}, // ID_CAP_PICKER_CONTRACT_UI
+    {263857873U, 668005494U, 761739732U, 3161538771U, 3465510183U, 3966289959U, 1371968467U, 3523812172U}, // ID_CAP_PLATFORM_EXTENSIBILITY
+    {4135206061U, 582434690U, 1900056196U, 4015487949U, 1559463082U, 3463418647U, 1551032956U, 3344374627U}, // ID_CAP_PLAYREADY
+    {1474501820U, 3232880798U, 2006118808U, 2747960001U, 3601944205U, 1577101783U, 2320002750U, 1096534255U}, // ID_CAP_PLAYREADY_ADMIN
+    {2713479009U, 3760410636U, 1990513139U, 2266841327U, 2303751126U, 1036088881U, 3793625412U, 2788919387U}, // ID_CAP_PM_1ST_PARTY
+    {1787915205U, 537676324U, 2472011802U, 3492231904U, 2180748126U, 1410900452U, 865282622U, 437816859U}, // ID_CAP_PM_BSS
+    {409391139U, 3678628100U, 88783411U, 2167653157U, 3897844515U, 3643021853U, 3623997344U, 183382781U}, // ID_CAP_PM_INSTALL
+    {3241153397U, 4253432039U, 3060799236U, 2826707152U, 528194885U, 624909121U, 2824628106U, 3898666271U}, // ID_CAP_POIDATASTORE
+    {36401258U, 70587612U, 3344916962U, 2637588153U, 750258949U, 2245180435U, 3584210656U, 3494484257U}, // ID_CAP_POIDATASTORE_ADMIN
+    {3957936651U, 675018005U, 871611421U, 2519705367U, 4242222257U, 3893829117U, 3884204443U, 1390290388U}, // ID_CAP_POLICY_MANAGER
+    {3602938784U, 1787358088U, 2214661780U, 2664954802U, 116148370U, 2166160257U, 2890858203U, 1037968683U}, // ID_CAP_POLICY_MANAGER_READONLY
+    {2842245559U, 1032864762U, 2796624370U, 3738001547U, 3923490807U, 610429759U, 4111349424U, 625336189U}, // ID_CAP_POWERNOTIF_USER
+    {1040435922U, 1881642974U, 3585912161U, 3905079216U, 3824131167U, 2818711098U, 1854894868U, 1454561357U}, // ID_CAP_PRESERVED_DATA
+    {3702191546U, 3015283016U, 2770801629U, 140592313U, 3626316548U, 384334985U, 2679690187U, 3889822510U}, // ID_CAP_PRIV_ABOUTCPL
+    {641654939U, 3619459617U, 1817410735U, 3128114563U, 2920764708U, 2319836985U, 186954442U, 2689732995U}, // ID_CAP_PRIV_ACCESSIBILITYCPL
+    {1957495988U, 9070034U, 1066404512U, 2743696392U, 3662991827U, 749116265U, 3833210910U, 2144140122U}, // ID_CAP_PRIV_ACCESSORIESCPL
+    {2264900124U, 3115219258U, 2345001936U, 2525181199U, 2649606114U, 1195785519U, 3023695549U, 3081121857U}, // ID_CAP_PRIV_ACCESSORYMGRSVC
+    {1595602080U, 2174720952U, 3404583962U, 2795576728U, 583970693U, 4049526650U, 2919582939U, 3040619670U}, // ID_CAP_PRIV_ACCOUNTPROVSVC
+    {3391759911U, 2094846081U, 472448896U, 2280649339U, 450275198U, 425525103U, 3516743378U, 3343886691U}, // ID_CAP_PRIV_ACTIONURIHOST
+    {381909091U, 2365016122U, 3893428437U, 1117404609U, 4122627759U, 2114458955U, 1417699003U, 1682309209U}, // ID_CAP_PRIV_ADVERTISINGIDCPL
+    {2242391463U, 3407473979U, 1378926805U, 3074188594U, 432398863U, 2188291461U, 3411751299U, 946431060U}, // ID_CAP_PRIV_ALARMS
+    {3837422361U, 1237665578U, 2993208839U, 2972581921U, 4122890600U, 1286407940U, 688296345U, 1713069640U}, // ID_CAP_PRIV_APHCHECK
+    {1535128064U, 3143797225U, 2154691268U, 1269457339U, 381526852U, 3867687138U, 1864555621U, 3329420561U}, // ID_CAP_PRIV_APMUX
+    {2878609352U, 954291332U, 2934343509U, 1131563372U, 833735718U, 1261023847U, 863804488U, 3309935605U}, // ID_CAP_PRIV_APPCORNER
+    {171712513U, 3514896565U, 998684375U, 1254289810U, 2187163862U, 3663546875U, 1698503927U, 3157483820U}, // ID_CAP_PRIV_APPPREINSTALLER
+    {554445715U, 786742564U, 3694002357U, 3330233460U, 3753618773U, 2156863345U, 1096407208U, 2476597743U}, // ID_CAP_PRIV_APPRESOLVERUI
+    {3487696297U, 3818970554U, 1252033260U, 3159224757U, 4038316234U, 2125376538U, 302071528U, 3549326548U}, // ID_CAP_PRIV_APPSDATAMIGRATOR
+    {2028063034U, 3435194610U, 2537653425U, 1503090012U, 2663390257U, 1010064664U, 2201220037U, 1444065661U}, // ID_CAP_PRIV_APPXEXECUTIONSVC
+    {2087085145U, 804720880U, 3188751303U, 1794981167U, 3446334287U, 103296073U, 3856581979U, 894240969U}, // ID_CAP_PRIV_AUTHHOST_MSA
+    {3748557192U, 518451112U, 1917154877U, 2262962197U, 147719570U, 4172978667U, 3488055974U, 1988248097U}, // ID_CAP_PRIV_AUTHHOST_WAB_A
+    {1067666594U, 2251637702U, 2247661982U, 2004280476U, 3231167036U, 1483383452U, 4043679821U, 1920683115U}, // ID_CAP_PRIV_AUTHHOST_WAB_B
+    {3182100364U, 1451944607U, 2416512064U, 1994434789U, 292355036U, 619209970U, 2082589176U, 2107921668U}, // ID_CAP_PRIV_AUTHHOST_WAB_C
+    {3609652516U, 4119078797U, 1208279700U, 423323704U, 2403816950U, 4250274817U, 571205077U, 1749820534U}, // ID_CAP_PRIV_AUTHHOST_WAB_ENTERPRISE
+    {1813102526U, 1050097282U, 3157014254U, 506371058U, 1823446901U, 2235907117U, 55484178U, 2123552703U}, // ID_CAP_PRIV_AUTHHOST_WAB_SSO
+    {1199127588U, 4224496176U, 3316764925U, 2369587502U, 1950588394U, 1064700127U, 4292847958U, 1032528592U}, // ID_CAP_PRIV_AUTHHOST_WAB_SSO_ENTERPRISE
+    {1143416519U, 1427344381U, 836360883U, 1713309379U, 3503698209U, 2452405763U, 2104369788U, 1926333410U}, // ID_CAP_PRIV_AUTOTIMEUPDATE
+    {1263478506U, 2474863908U, 3409420883U, 3719976846U, 1318563334U, 1629709465U, 110908757U, 515606643U}, // ID_CAP_PRIV_BATTERYSAVERCPL
+    {3763269965U, 3170182059U, 1814927891U, 2640840731U, 2849796068U, 3398854441U, 2582491206U, 3503159186U}, // ID_CAP_PRIV_BLUETOOTHPBAPSVC
+    {3820358817U, 2071704856U, 3934932299U, 1602842318U, 2949701797U, 1191893763U, 1563299998U, 373929023U}, // ID_CAP_PRIV_BMR2MONITORSVC
+    {100017478U, 2625106909U, 749295355U, 2858628561U, 438098371U, 3423777609U, 2069243033U, 622872817U}, // ID_CAP_PRIV_BMR2SCHEDULETRIGGER
+    {2013155637U, 1348218385U, 3491624005U, 677927633U, 3018268477U, 967545437U, 1349403044U, 696104603U}, // ID_CAP_PRIV_BMRCPL
+    {3748851708U, 2201806123U, 3995113674U, 3473972530U, 1649424221U, 4058121144U, 4260912961U, 1499625741U}, // ID_CAP_PRIV_BMRSCHEDULETRIGGER
+    {2101144736U, 24086467U, 3822401137U, 1825411697U, 3592091852U, 3303705241U, 1013927376U, 1914276837U}, // ID_CAP_PRIV_BRIGHTNESSCPL
+    {2953686488U, 3244031514U, 3661439912U, 3864866633U, 42195657U, 2715269461U, 779122698U, 3330650105U}, // ID_CAP_PRIV_BSSVC
+    {1661448537U, 919023469U, 735967288U, 1509840846U, 3311692890U, 853435374U, 1423953998U, 2597194198U}, // ID_CAP_PRIV_BTAGSERVICE
+    {3677158147U, 2531316027U, 616390032U, 2011690052U, 1169450927U, 1771205767U, 2629006959U, 2590607143U}, // ID_CAP_PRIV_BTCONNMGR
+    {2283308498U, 3418168164U, 2871610685U, 2497950421U, 893254441U, 630671784U, 2571566870U, 2975926952U}, // ID_CAP_PRIV_BTHAVCTPSVC
+    {1064962950U, 3174434449U, 13947245U, 1084156204U, 1782554780U, 3790103479U, 2348472782U, 1693109098U}, // ID_CAP_PRIV_BTSERV
+    {1311357076U, 2307295700U, 1542398105U, 3006901857U, 155434232U, 1166697143U, 1967422306U, 3855172469U}, // ID_CAP_PRIV_BTUXCPL
+    {1654548421U, 1917889256U, 902976745U, 3110127035U, 2162851155U, 2790573582U, 529516099U, 2924352939U}, // ID_CAP_PRIV_CALC7
+    {2868668808U, 146244289U, 1013011948U, 3156134918U, 3100598749U, 3270096424U, 1121277156U, 3002655840U}, // ID_CAP_PRIV_CAPTURESVC
+    {4158439329U, 925322638U, 2357067637U, 121089629U, 3448699366U, 1143018234U, 209007650U, 1133280156U}, // ID_CAP_PRIV_CASVCSHARED3
+    {2294816394U, 3235242823U, 348589421U, 4101802767U, 3912655153U, 439414880U, 3461527793U, 435546990U}, // ID_CAP_PRIV_CELLMANAGER
+    {2771849597U, 651062666U, 1932460855U, 209623011U, 1033959201U, 1525748800U, 806370714U, 762061446U}, // ID_CAP_PRIV_CELLULARDATACOLLECTOR
+    {2111488033U, 2058533601U, 4147973870U, 454350674U, 1363887214U, 677647169U, 3476779878U, 1241690390U}, // ID_CAP_PRIV_CELLUX
+    {725538050U, 1907153280U, 521305483U, 677231200U, 1877408990U, 2767757795U, 2340704612U, 1355492110U}, // ID_CAP_PRIV_CERTINSTALLER
+    {2758880953U, 229425033U, 1378191474U, 2534007397U, 375331563U, 3003877757U, 1405607080U, 2605462748U}, // ID_CAP_PRIV_CFMSVC
+    {3320435731U, 3817745133U, 2699194035U, 779285069U, 4003765145U, 684786849U, 3790766046U, 2141292731U}, // ID_CAP_PRIV_CGSVC
+    {2882190351U, 1900132400U, 2389504047U, 3283113898U, 1562639320U, 1954149104U, 2204098722U, 4231309866U}, // ID_CAP_PRIV_CLOUDSTORAGECPL
+    {909664345U, 3717087928U, 1798897248U, 2198635541U, 2083468042U, 844014597U, 3087740421U, 1229840519U}, // ID_CAP_PRIV_CMSERVICE
+    {1918073098U, 4270625974U, 2793915480U, 2845556562U, 1725189868U, 591295631U, 2814514745U, 2666683318U}, // ID_CAP_PRIV_COMMANDCHANNEL
+    {3984546063U, 3753728537U, 3240573427U, 1705931156U, 3731643542U, 1575945508U, 3677024129U, 3217349060U}, // ID_CAP_PRIV_COMMSAPHOST
+    {4269924204U, 1432115617U, 2276348624U, 1527206843U, 2538190826U, 2044232883U, 597212342U, 2757615184U}, // ID_CAP_PRIV_COMMSAPPLICATIONS
+    {3186606985U, 1559859482U, 1383161800U, 2779233149U, 4049616259U, 438737389U, 3717049039U, 1559903363U}, // ID_CAP_PRIV_COMMSCERTINSTSVC
+    {3570828876U, 2449304231U, 1447458514U, 4166460550U, 1325067112U, 1937621693U, 701994133U, 1229712047U}, // ID_CAP_PRIV_COMMSMESSAGESVC
+    {3725804922U, 1405377437U, 927002710U, 397285623U, 2546525998U, 1731533221U, 1407242702U, 4050426102U}, // ID_CAP_PRIV_COMMSMMSTRANSPORT
+    {2621497959U, 3409937390U, 3034511946U, 1091013387U, 720518078U, 1794943562U, 4140314382U, 189349493U}, // ID_CAP_PRIV_CONTACTSTOKENSVC
+    {1900095981U, 2740182768U, 1666706949U, 1387942982U, 2694400541U, 2630027509U, 2562029196U, 600678296U}, // ID_CAP_PRIV_CONTENTSHARESVC
+    {1880489724U, 2772989376U, 3865513202U, 44913138U, 1120520757U, 3547367450U, 116773904U, 1713866488U}, // ID_CAP_PRIV_CONTENTSHARINGAPP
+    {97886205U, 2132118884U, 11127097U, 2831259083U, 3080785905U, 1973872878U, 4279921153U, 2889656453U}, // ID_CAP_PRIV_COREUIREGISTRAR
+    {884565313U, 2237566239U, 1474645701U, 511570554U, 286898737U, 3595755270U, 3457832312U, 2714042919U}, // ID_CAP_PRIV_DACCERTINSTSVC
+    {2034919452U, 68564597U, 3540405225U, 467401073U, 1284598087U, 1803212676U, 1555303465U, 2962789269U}, // ID_CAP_PRIV_DATACOLLECTION
+    {219590132U, 2705272766U, 1289053499U, 2676897044U, 1786461788U, 3758284882U, 3169161312U, 1324696326U}, // ID_CAP_PRIV_DATASENSESVC
+    {2698771304U, 3218752907U, 3710736025U, 1005754343U, 4093697657U, 426895070U, 3709630612U, 1837112635U}, // ID_CAP_PRIV_DATASMART
+    {2074233398U, 1313347228U, 3413325327U, 2273270931U, 1918492852U, 3344091505U, 1445030439U, 111432151U}, // ID_CAP_PRIV_DATETIMECPL
+    {4252180316U, 2012523948U, 1998919462U, 226244827U, 2251911756U, 1899007206U, 4274800325U, 2289022885U}, // ID_CAP_PRIV_DCPSVC
+    {4248291447U, 3266028882U, 2644683550U, 2878301708U, 716368600U, 390998217U, 1946024266U, 352767815U}, // ID_CAP_PRIV_DEBUGGERMUXNOTIFY
+    {914988669U, 1927506841U, 3831045698U, 3631598257U, 3751465082U, 1933918687U, 1400885089U, 3272328612U}, // ID_CAP_PRIV_DIAGNOSTICSVC
+    {3759315688U, 2856993014U, 2743258494U, 699275445U, 1386300459U, 2025907227U, 3508935989U, 2177680138U}, // ID_CAP_PRIV_DMCFGHOST
+    {618746054U, 3879552457U, 3833388763U, 3718681835U, 3259083511U, 2389644374U, 2632927989U, 1153219902U}, // ID_CAP_PRIV_DMOMACPNETWMO
+    {1241477014U, 3569732393U, 2868988194U, 522785542U, 405843953U, 2428621998U, 2426863335U, 4189218443U}, // ID_CAP_PRIV_DMOMACPUSERMO
+    {50356377U, 2971133637U, 1411370572U, 4145314111U, 3421706337U, 346246495U, 3345077987U, 3555642185U}, // ID_CAP_PRIV_DMWAPPUSHSVC
+    {2756568060U, 3773383040U, 1414135456U, 2519682590U, 1885648463U, 531811447U, 3553129208U, 3860684886U}, // ID_CAP_PRIV_DRIVINGMODEMANAGER
+    {1893210312U, 950967227U, 4228776452U, 3178098267U, 961874846U, 696050049U, 1549345933U, 637617379U}, // ID_CAP_PRIV_DRIVINGMODESETTINGS
+    {938158914U, 3769818490U, 234441976U, 3823975914U, 3714444632U, 544707441U, 3433724106U, 3130068214U}, // ID_CAP_PRIV_DSSVC
+    {1753598334U, 175428066U, 3235084942U, 3715693363U, 2936718260U, 543860685U, 943928971U, 4255618496U}, // ID_CAP_PRIV_DSTOKENCLEAN
+    {2986130805U, 2501413322U, 3791395340U, 3785215683U, 2579544666U, 3361237126U, 2315275830U, 1785470271U}, // ID_CAP_PRIV_DUACALLBACK
+    {2777658290U, 2279636284U, 388574346U, 537721074U, 1755329013U, 926272591U, 2720218503U, 777776038U}, // ID_CAP_PRIV_DUACLIENT
+    {3606199257U, 3829471794U, 3355387145U, 3805852311U, 3174850739U, 2135137762U, 865637246U, 1165399117U}, // ID_CAP_PRIV_DUCLEANUPMIGRATOR
+    {2335941011U, 3817492661U, 4128572821U, 24475218U, 2490126733U, 3793754962U, 1893228051U, 662051538U}, // ID_CAP_PRIV_DUFEATUREDISCOVERY
+    {4159897836U, 3778929071U, 74288370U, 2928828425U, 2700522578U, 2235318407U, 1549996062U, 2977265692U}, // ID_CAP_PRIV_DUMIGRATIONMANAGER
+    {2951303005U, 4017712365U, 1896609040U, 517523023U, 424445880U, 2353086900U, 330339111U, 2991073158U}, // ID_CAP_PRIV_DUMIGRATIONPROVISIONERMICROSOFT
+    {2581096325U, 507112302U, 1729479335U, 1377207035U, 1901540171U, 683712378U, 3164889141U, 3045397011U}, // ID_CAP_PRIV_DUMIGRATIONPROVISIONEROEM
+    {2678583037U, 3015163657U, 4172577353U, 415680508U, 3900316683U, 828873744U, 3506516500U, 1926251190U}, // ID_CAP_PRIV_DUPOSTUPDATEUX
+    {3816824273U, 3012473954U, 2342779036U, 4030732423U, 1327003114U, 2535927213U, 2707047973U, 4187153080U}, // ID_CAP_PRIV_DUSTARTINGMIGRATOR
+    {1252443961U, 848623433U, 1222398577U, 2695879723U, 1985881823U, 1240021980U, 3398709914U, 1367397820U}, // ID_CAP_PRIV_DUSVC
+    {3485559230U, 270281049U, 376685461U, 408548396U, 1234813444U, 3738382694U, 1153077705U, 4163440403U}, // ID_CAP_PRIV_ENROLLMENTCLIENT
+    {3868996226U, 977271375U, 822085508U, 1450021620U, 1780891435U, 1926137217U, 722674342U, 683633183U}, // ID_CAP_PRIV_ENTAPPSERVICE
+    {1358151887U, 431265856U, 3821682637U, 2629604649U, 2988011301U, 2255509346U, 486164975U, 2410112989U}, // ID_CAP_PRIV_ENTERPRISEINSTALL
+    {781896196U, 1223984037U, 3258298040U, 1061519067U, 2169943435U, 2093573927U, 2449958595U, 2049344320U}, // ID_CAP_PRIV_ENTERPRISEMGMSVC
+    {1805563264U, 1780196009U, 179773414U, 3580453194U, 3483601531U, 2111661327U, 3150942770U, 2153924705U}, // ID_CAP_PRIV_ENTERPRISERING
+    {662772353U, 1486615530U, 871545394U, 1448426327U, 510098464U, 4116524330U, 2676296192U, 1484244256U}, // ID_CAP_PRIV_ENTERPRISEVALIDATION
+    {2823247981U, 3776508852U, 414256269U, 2235771749U, 1270235241U, 213784370U, 1969438168U, 3571734898U}, // ID_CAP_PRIV_EXECMANSERVICE
+    {3528575947U, 2082175261U, 1515314448U, 2988173106U, 2580967201U, 1810545037U, 2275089234U, 1670465866U}, // ID_CAP_PRIV_FINDMYPHONE
+    {191048540U, 721407936U, 241604018U, 737656606U, 3165831124U, 3710910690U, 543113175U, 2195473783U}, // ID_CAP_PRIV_FLYOUTDATAMIGRATOR
+    {270926002U, 2390683205U, 2629159142U, 468774789U, 1547585856U, 2679586204U, 2531634935U, 3680400465U}, // ID_CAP_PRIV_GROVELER
+    {2282877110U, 451725208U, 4253761080U, 864674258U, 2679644245U, 2697973601U, 2313802016U, 2069110607U}, // ID_CAP_PRIV_GWPCENROLLSVC
+    {3669755556U, 806554671U, 2628500819U, 650864940U, 912276399U, 2365803980U, 3203072321U, 3459722635U}, // ID_CAP_PRIV_HFA
+    {2963954832U, 3109667677U, 1970791642U, 2181992142U, 1556456298U, 3411533242U, 1915486735U, 1393436518U}, // ID_CAP_PRIV_HOTSPOTHOST
+    {847620514U, 3120824431U, 619625590U, 4277702541U, 802900985U, 1120582411U, 2692267185U, 1374007447U}, // ID_CAP_PRIV_HUBTILERESTOREHOST
+    {306884668U, 4074167805U, 4162618654U, 2048162625U, 618345260U, 3140339046U, 936887725U, 2787263824U}, // ID_CAP_PRIV_ICSENTITLEMENTHOST
+    {4021440844U, 3671501580U, 613825872U, 2600983013U, 1521389129U, 1620461136U, 3364486837U, 205964572U}, // ID_CAP_PRIV_ICSSVC
+    {1079608954U, 912595864U, 3714627136U, 312640869U, 759709924U, 2804687460U, 964260425U, 1077569771U}, // ID_CAP_PRIV_INPUTSERVICE
+    {1092561290U, 667732417U, 2582754862U, 2423160383U, 1121008381U, 2640335693U, 3141220507U, 2478737640U}, // ID_CAP_PRIV_INSTALLERWORKER
+    {2588094740U, 411879449U, 2974275014U, 842057546U, 2910191738U, 2087297976U, 4053104604U, 4183899876U}, // ID_CAP_PRIV_INTERNETEXPLORER
+    {678199816U, 3862272940U, 3874397148U, 2791747786U, 2444939011U, 1994217409U, 3303480927U, 2371145845U}, // ID_CAP_PRIV_IPOVERUSB
+    {1175044270U, 2227388863U, 2175933357U, 4032654743U, 1674745371U, 94929287U, 3366867433U, 4222577397U}, // ID_CAP_PRIV_KEYBOARDCPL
+    {49602385U, 1358416099U, 2214300170U, 1847033715U, 1308293252U, 1929746912U, 1076142241U, 2437606485U}, // ID_CAP_PRIV_KIDZONECONFIGURATION
+    {148409550U, 2935273770U, 3748069116U, 3653793863U, 2138771866U, 2077171053U, 1803638391U, 2884183948U}, // ID_CAP_PRIV_KIDZONECUSTOMIZATION
+    {3865140078U, 1447353156U, 2141374843U, 1536353842U, 582098320U, 2044075971U, 3640596553U, 1256627641U}, // ID_CAP_PRIV_LASSCREDENTIALEXPIRATIONCHECK
+    {2593718493U, 2467597238U, 2087101239U, 3469223724U, 3884163621U, 2439614441U, 1412188656U, 3499485220U}, // ID_CAP_PRIV_LAUNCHAPPSVC
+    {2575724350U, 270990983U, 427984501U, 3237712194U, 3749340801U, 487435722U, 1318817432U, 2577895967U}, // ID_CAP_PRIV_LEXICONUPDATE
+    {330770410U, 3278750078U, 2243289951U, 3324409014U, 1624942838U, 1335934781U, 731050806U, 2436124280U}, // ID_CAP_PRIV_LFSVC
+    {2208924548U, 2949165698U, 2901136198U, 3736292773U, 3260947744U, 782056639U, 1501481938U, 3564265321U}, // ID_CAP_PRIV_LIVETOKEN
+    {4204812590U, 2121059246U, 274608362U, 3739993598U, 758867839U, 1326983720U, 382553715U, 1218542030U}, // ID_CAP_PRIV_LOCATIONUXCPL
+    {3377381122U, 2566705835U, 2117205411U, 3916673358U, 3335899580U, 488998617U, 3826672157U, 3350042513U}, // ID_CAP_PRIV_LOCKANDWALLPAPER
+    {3347215405U, 1244869068U, 1890367129U, 2613811403U, 3047147966U, 2956072433U, 739022923U, 343410392U}, // ID_CAP_PRIV_MEDIA
+    {455976710U, 821893757U, 2630592200U, 35478687U, 1737164584U, 112426754U, 3433470142U, 2593996472U}, // ID_CAP_PRIV_MEDIASERVICE
+    {235196125U, 1398389906U, 407879002U, 202570404U, 2821558941U, 1236231554U, 2280234712U, 2435843284U}, // ID_CAP_PRIV_MIRRORCPL
+    {3865135691U, 3995097961U, 3172769699U, 3035620359U, 3959983614U, 3527906269U, 1801648162U, 3664623177U}, // ID_CAP_PRIV_MOBILEUI
+    {1793409214U, 2989265577U, 1560224842U, 265991411U, 3011945704U, 1403349331U, 2752070706U, 3482104922U}, // ID_CAP_PRIV_MOSHOST
+    {629535606U, 795344890U, 2664575405U, 773753174U, 2998394682U, 3981686494U, 737072917U, 4150966295U}, // ID_CAP_PRIV_MSATICKETSVC
+    {3846147313U, 93628275U, 2655953855U, 3571274273U, 2272908779U, 113122007U, 35580341U, 2798989312U}, // ID_CAP_PRIV_MSGIMTRANSPORT
+    {2497720928U, 1015098519U, 4292111178U, 696988299U, 3830574450U, 1804235028U, 381582540U, 1005772751U}, // ID_CAP_PRIV_MSGSMSTRANSPORT
+    {1840263933U, 2482162046U, 3711000570U, 3838599994U, 2109192735U, 2420745102U, 2590622915U, 1952638968U}, // ID_CAP_PRIV_MTP
+    {1181420905U, 540071444U, 604248028U, 2013241061U, 2411354483U, 2026473845U, 3365982654U, 1672816109U}, // ID_CAP_PRIV_MVPROVISIONHOST
+    {3075372479U, 3883527891U, 4162398239U, 2135503463U, 65665125U, 3019373915U, 2450561919U, 17651958U}, // ID_CAP_PRIV_MVUX
+    {3957654617U, 928860116U, 157370293U, 2123702337U, 3106085848U, 2231893509U, 2631954982U, 2674616668U}, // ID_CAP_PRIV_NABSYNC
+    {3853223726U, 3741035021U, 1138770937U, 1599623577U, 1068447796U, 1444538781U, 1998564519U, 3270494465U}, // ID_CAP_PRIV_NOCENTERSETTINGSCPL
+    {1076528788U, 216827213U, 1622226201U, 2963220978U, 2921779409U, 4177726458U, 2460723215U, 1429884197U}, // ID_CAP_PRIV_NOTIFICATIONPLATFORMMIGRATOR
+    {2346244069U, 1085784738U, 1655700058U, 502073420U, 1731254820U, 4032604137U, 904990341U, 2868863963U}, // ID_CAP_PRIV_NOTIFSVC
+    {3673087306U, 3729677189U, 1986109835U, 4213265359U, 726331438U, 1203736147U, 1257127227U, 396186728U}, // ID_CAP_PRIV_OFFICE
+    {1604915989U, 2895934960U, 3994119388U, 3886423788U, 1244775661U, 1968485600U, 3231407801U, 512623004U}, // ID_CAP_PRIV_OMADMCLIENT_ENTERPRISE
+    {1344405089U, 4173432893U, 2585552285U, 2224571002U, 1748971021U, 1609676992U, 853613614U, 2828792277U}, // ID_CAP_PRIV_OMADMCLIENT_MOBILE_OPERATOR
+    {1773742578U, 2510474095U, 905645315U, 2245679183U, 262861516U, 761192269U, 916028203U, 1991670177U}, // ID_CAP_PRIV_OMADMPRC
+    {453890642U, 1824426784U, 2811616944U, 4140594911U, 1646688992U, 2506124761U, 995023766U, 2341514785U}, // ID_CAP_PRIV_OOBE
+    {3181400452U, 1416797908U, 989308977U, 3747790696U, 3734543501U, 1696371547U, 2808734069U, 2151008871U}, // ID_CAP_PRIV_ORIENTSRV
+    {2805189855U, 1003017166U, 1483974709U, 1272717043U, 3720491416U, 2069662796U, 2496644083U, 2984512930U}, // ID_CAP_PRIV_PACMANSERVICE
+    {2326117251U, 1620536281U, 669501415U, 3467979545U, 210332888U, 2100455439U, 707937703U, 2257210027U}, // ID_CAP_PRIV_PHONEAUDIOSRV
+    {3508897389U, 4162870154U, 3700854653U, 3770205739U, 2874146367U, 3200038617U, 3090654645U, 1346675237U}, // ID_CAP_PRIV_PHONEPROVISIONER
+    {2785912586U, 3542183935U, 2230668930U, 1378316680U, 379057243U, 1254432061U, 180818681U, 2551661520U}, // ID_CAP_PRIV_PHONEPROVISIONER_OEM
+    {3785756314U, 1874037688U, 486831059U, 3600736452U, 1573102536U, 3041828395U, 2534607632U, 601551653U}, // ID_CAP_PRIV_PHONESVCSG
+    {3007893774U, 402715186U, 3423798824U, 808586143U, 645551963U, 1912673359U, 3725514144U, 2375488130U}, // ID_CAP_PRIV_PHOTOS
+    {2679213671U, 32594753U, 3922348643U, 2182191201U, 1577815601U, 2520298925U, 99644993U, 2335202314U}, // ID_CAP_PRIV_PHOTOSSVC
+    {1555797320U, 3683531226U, 2270661382U, 2352025297U, 1235015464U, 1936320398U, 1870536153U, 3258992755U}, // ID_CAP_PRIV_PIMIDXMAINT
+    {1496173690U, 1301178569U, 4038177218U, 3216581340U, 3749721013U, 1088109777U, 2384061977U, 278242253U}, // ID_CAP_PRIV_PLACESSVC
+    {3706962620U, 4170894011U, 81612047U, 1286833363U, 4234944144U, 4029078484U, 1726981636U, 4274159480U}, // ID_CAP_PRIV_POSTDUAPPMIGRATOR
+    {509696209U, 1374255475U, 3159938698U, 3491878826U, 361171972U, 3733741909U, 1891142005U, 1873167936U}, // ID_CAP_PRIV_POWERNOTIF
+    {144776972U, 4074767306U, 3854404797U, 764210525U, 3504231269U, 4052897789U, 491844826U, 4072424361U}, // ID_CAP_PRIV_PROXIMITYSVC
+    {2323376210U, 3522073209U, 741873721U, 894459224U, 4144752506U, 1299807612U, 4001944925U, 4033841544U}, // ID_CAP_PRIV_PROXYSVC
+    {2445051088U, 668463070U, 3263314086U, 4048754527U, 1495437973U, 39761879U, 886721520U, 804229004U}, // ID_CAP_PRIV_REALWORLD-BINGCLIENT
+    {2194764022U, 36395575U, 952434030U, 410191612U, 1452133946U, 3025999701U, 2346555989U, 203037131U}, // ID_CAP_PRIV_REALWORLD-INTERESTEXTRACTION
+    {1687306117U, 1885862730U, 4063032495U, 2885838198U, 582824517U, 1057012852U, 1861447068U, 2528209113U}, // ID_CAP_PRIV_REBOOTDEVICE
+    {1675877585U, 2086428330U, 449488024U, 3877568825U, 1001594570U, 1443186182U, 2680730761U, 498367727U}, // ID_CAP_PRIV_REGIONCPL
+    {1145325953U, 4114910318U, 1583895851U, 2153160487U, 984366925U, 4052651286U, 4093824185U, 1407802964U}, // ID_CAP_PRIV_REMEMBER
+    {128032855U, 1754782114U, 752026468U, 2074317649U, 3535103907U, 3893063264U, 1319344974U, 4271339800U}, // ID_CAP_PRIV_RETAILDEMO
+    {1188913571U, 3049063334U, 1766416304U, 3571428810U, 3265128233U, 1294081094U, 3992520170U, 1228541022U}, // ID_CAP_PRIV_RETAILDEMOERROR
+    {19490414U, 843937673U, 3458097499U, 4116789322U, 472851226U, 4164274620U, 642444220U, 3449409126U}, // ID_CAP_PRIV_RETAILDEMOGLOB
+    {2763853371U, 488130636U, 348967529U, 790117186U, 3176945693U, 508165567U, 4275720762U, 2260152372U}, // ID_CAP_PRIV_RETAILDEMOUI
+    {153050110U, 626303931U, 1046838420U, 2593488200U, 1836760913U, 3066325101U, 3208405356U, 2436514250U}, // ID_CAP_PRIV_RILADAPTATION
+    {1010274897U, 3904291097U, 1962684232U, 2804906464U, 2541944627U, 3164952978U, 2138410719U, 2728307944U}, // ID_CAP_PRIV_RINGTONESANDSOUNDS
+    {1402639919U, 3055683677U, 336774465U, 733452007U, 3197485064U, 3101458112U, 200313199U, 1361576526U}, // ID_CAP_PRIV_ROAMINGCPL
+    {1329835884U, 1827042785U, 2977984329U, 1061632676U, 1575172798U, 2484958169U, 1671776830U, 1162567977U}, // ID_CAP_PRIV_ROTATIONLOCKCPL
+    {1851051100U, 271001978U, 729909982U, 4213198121U, 2378011146U, 2999808796U, 378980369U, 2877206897U}, // ID_CAP_PRIV_SAPISVR
+    {866457620U, 3033726891U, 3539250251U, 3443294893U, 3726445504U, 4162692273U, 3085621964U, 2979677530U}, // ID_CAP_PRIV_SECMIGRATOR
+    {900621135U, 777576200U, 3262908787U, 1669140659U, 268385349U, 3853891864U, 3531183707U, 1510522807U}, // ID_CAP_PRIV_SEMGRSVC
+    {1846576912U, 4188359778U, 2380320168U, 642780779U, 4184405186U, 2097067261U, 48739394U, 800067655U}, // ID_CAP_PRIV_SETTINGS
+    {3047934760U, 443676354U, 4021764950U, 1111729992U, 1299170816U, 1644206259U, 1047007023U, 2164007222U}, // ID_CAP_PRIV_SHELLDATAMIGRATOR
+    {1846372275U, 3902299590U, 728996079U, 1008693644U, 358283018U, 1997959091U, 2032637498U, 3972537969U}, // ID_CAP_PRIV_SIREPSVC
+    {3499926967U, 1715728708U, 3506064420U, 69368955U, 3160133688U, 2509407685U, 2541674339U, 3452143391U}, // ID_CAP_PRIV_SOFTAPUX
+    {3968925344U, 3321291181U, 2336227132U, 4180140137U, 1799090108U, 1057914892U, 942685562U, 1505049321U}, // ID_CAP_PRIV_SPEECHCPL
+    {1642006283U, 3590874400U, 80585082U, 1289770722U, 1716343415U, 501789257U, 3129029025U, 2940269942U}, // ID_CAP_PRIV_SPEECHUPDATE
+    {2352660754U, 1980193992U, 1626957833U, 1720928371U, 1815679778U, 2842466853U, 2281914575U, 4091306965U}, // ID_CAP_PRIV_START
+    {1228252831U, 2612103376U, 1387232236U, 1515793978U, 1412596218U, 291077060U, 1657792623U, 825601594U}, // ID_CAP_PRIV_STORAGESENSE
+    {1468606356U, 4035052994U, 488624892U, 1625063169U, 2266851081U, 1303748536U, 2981103760U, 2479904601U}, // ID_CAP_PRIV_STORAGESVC
+    {3879295650U, 3554164702U, 3518470807U, 2654488524U, 916544985U, 3750166385U, 980248580U, 3063545627U}, // ID_CAP_PRIV_STOREDATAMIGRATOR
+    {2320411231U, 1654054039U, 674540330U, 1067228464U, 2579816226U, 3839349312U, 2395609579U, 357628434U}, // ID_CAP_PRIV_TASKSCHEDULERSVC
+    {1192630719U, 1802086783U, 560408355U, 172355066U, 2613382029U, 2075422834U, 3808559831U, 3556367855U}, // ID_CAP_PRIV_TELCPL
+    {759954567U, 1618879035U, 3632911063U, 3472614560U, 3201000577U, 3364991510U, 2496267392U, 263670935U}, // ID_CAP_PRIV_TELREPSVC
+    {898148464U, 3110238085U, 2208206135U, 945149308U, 4203246047U, 2114786413U, 2313048350U, 2090040086U}, // ID_CAP_PRIV_THEMECPL
+    {436586185U, 52026773U, 166765969U, 1036123937U, 3234533600U, 419960641U, 84466538U, 3635236668U}, // ID_CAP_PRIV_TILEMIGRATOR
+    {1607326801U, 1418366153U, 2845693517U, 3449709441U, 1325711313U, 2236638209U, 2258714324U, 2685403428U}, // ID_CAP_PRIV_TIMEBROKER
+    {4009101666U, 2046666388U, 2265272283U, 1905888259U, 1028963590U, 822603263U, 4073515277U, 932005488U}, // ID_CAP_PRIV_UPDATEMGRSVC
+    {3345406764U, 3047951656U, 3071345274U, 1012860710U, 3867128349U, 853175862U, 1262773352U, 2104799798U}, // ID_CAP_PRIV_USBCPL
+    {237799083U, 2620806313U, 90959224U, 2743396360U, 530499481U, 3745218533U, 2341364734U, 2171756426U}, // ID_CAP_PRIV_USERDATASERVICE
+    {2091010855U, 558178363U, 1942860068U, 1289906259U, 2851990124U, 2691632627U, 1993401933U, 2812194720U}, // ID_CAP_PRIV_USSREPORTING
+    {3887951740U, 209763086U, 4129200064U, 2241529657U, 1597837414U, 3688683413U, 1385269874U, 1077040733U}, // ID_CAP_PRIV_UTKSERVICE
+    {2662726976U, 2339697119U, 2568407464U, 6040295U, 2529839743U, 2593224188U, 428918422U, 2180621961U}, // ID_CAP_PRIV_UTKUX
+    {1473727530U, 1913640170U, 2920354824U, 1056580571U, 1735676004U, 3516014184U, 2321916061U, 2243555183U}, // ID_CAP_PRIV_VPNUX
+    {2800740417U, 3960537368U, 3860671560U, 1692167039U, 3939514354U, 633490387U, 2490733519U, 4018768329U}, // ID_CAP_PRIV_WALLET
+    {1636702302U, 736502375U, 1619490408U, 4207098407U, 1478649930U, 3083953453U, 86549318U, 253305477U}, // ID_CAP_PRIV_WALLETSVC
+    {2945130857U, 2788986573U, 1522490949U, 660827540U, 3680946165U, 2123117829U, 80153684U, 3461615539U}, // ID_CAP_PRIV_WEHCSPHELPER
+    {1765846408U, 4095915577U, 3632719808U, 734598617U, 597325396U, 1350587131U, 3807372523U, 1316931031U}, // ID_CAP_PRIV_WEHSTART
+    {1768860323U, 859935470U, 3668347347U, 1662408256U, 1734433167U, 2872585509U, 1769124977U, 2077265745U}, // ID_CAP_PRIV_WIFICONNSVC
+    {3528238444U, 625458789U, 1021096198U, 3535982755U, 2742208568U, 2031937915U, 4042484104U, 3718856618U}, // ID_CAP_PRIV_WIFICPASSIST
+    {2918598489U, 4106753816U, 3604508632U, 3926985554U, 3201382861U, 3619735703U, 2211680038U, 2908669717U}, // ID_CAP_PRIV_WIFICPBROWSERUX
+    {4261224142U, 385305163U, 3154034276U, 391765110U, 3494673162U, 585798159U, 1929288193U, 1133408915U}, // ID_CAP_PRIV_WIFIUDPTEST
+    {3476125085U, 5947471U, 2063433791U, 1160410943U, 2834054100U, 431249223U, 141882988U, 654641140U}, // ID_CAP_PRIV_WIFIUXBLUE
+    {2227539920U, 1699499254U, 4065405815U, 2682700641U, 961340992U, 2457430561U, 1572825959U, 3751603465U}, // ID_CAP_PRIV_WLID2MSA
+    {3806987487U, 986027095U, 1081727791U, 3723199209U, 3699472031U, 3905661352U, 3355870133U, 1009108391U}, // ID_CAP_PRIV_WPABSVC
+    {2624914177U, 1840331017U, 3257469297U, 3218753182U, 1932385198U, 239283691U, 1687747890U, 2122943858U}, // ID_CAP_PRIV_WPNARRATOR
+    {2342185665U, 2059775959U, 3318895248U, 1641810034U, 3293338477U, 2402245663U, 3685593602U, 2902108465U}, // ID_CAP_PRIV_WPNCERTINSTSVC
+    {3905052883U, 610759311U, 1031920692U, 2100938569U, 1233673723U, 3274484119U, 3510282391U, 4179381800U}, // ID_CAP_PRIV_WPTOOLS
+    {1491039157U, 639224935U, 2654770223U, 1394870486U, 845889126U, 3402672502U, 3894535851U, 501813140U}, // ID_CAP_PRIV_WPTPMVSCMGRSVC
+    {2179693112U, 3360703106U, 3461600832U, 3163758732U, 3517273755U, 1033647209U, 912284097U, 2993581610U}, // ID_CAP_PRIV_WPUITESTTOOLS
+    {1496374708U, 3706934006U, 3542559168U, 2885280943U, 2841798176U, 2499985327U, 1520182139U, 1540674074U}, // ID_CAP_PRIV_ZMEDIAQUEUESVC
+    {1273173521U, 3146712497U, 2078448291U, 2733458722U, 802909139U, 3203246355U, 2821146954U, 3585853921U}, // ID_CAP_PRIV_ZMF
+    {485196242U, 568124880U, 1124971611U, 4167431949U, 31846404U, 2037316491U, 438081976U, 696006945U}, // ID_CAP_PRIV_ZMF_SERVICE
+    {311846188U, 1726209071U, 393512827U, 486980478U, 1930539261U, 2256157363U, 3355037955U, 3399308413U}, // ID_CAP_PROVISIONING_PACKAGE_API_ADMIN
+    {2674953687U, 525956956U, 1760362519U, 1484842268U, 4192050511U, 891792023U, 232225477U, 1226868935U}, // ID_CAP_PROVISIONWPCERTIFICATE
+    {961832831U, 49560001U, 3564268277U, 823739369U, 4004423538U, 3929902754U, 3791854272U, 3235258508U}, // ID_CAP_PROXIMITY
+    {2349964318U, 1349071835U, 3700018674U, 2795839825U, 3356741129U, 2883669508U, 3470577093U, 3202784741U}, // ID_CAP_PUBLIC_FOLDER_FULL
+    {2037995276U, 2975854651U, 3902079615U, 2837029540U, 3919843913U, 2569769192U, 3786987952U, 2539465887U}, // ID_CAP_PUBLISH_ALARM_STATE
+    {700897504U, 2101906565U, 3334856130U, 3147460292U, 2959667128U, 605953356U, 630964237U, 3504531757U}, // ID_CAP_PUBLISH_OOBE_STATE
+    {1552926822U, 4258605051U, 132417780U, 2588897744U, 2674935403U, 69970809U, 231782294U, 4104277706U}, // ID_CAP_PUSHROUTER
+    {1672661162U, 3899259739U, 2140686688U, 3529225670U, 4192234406U, 3706555472U, 1474790597U, 3061776515U}, // ID_CAP_PUSH_NOTIFICATION
+    {2584469538U, 484866550U, 105467066U, 1167101339U, 2061030423U, 3276836675U, 1340675821U, 420200726U}, // ID_CAP_PUSH_SERVER
+    {2879991073U, 2910013877U, 773734470U, 2718964134U, 2106486440U, 1579062606U, 444251481U, 2472929647U}, // ID_CAP_QUICK_SETTINGS
+    {107706885U, 3845841341U, 3786024582U, 1766054307U, 3246899304U, 3594761745U, 1084978252U, 3871892453U}, // ID_CAP_READGWPCERTIFICATE
+    {656073835U, 2691465634U, 2133747329U, 2981653719U, 792909169U, 361252246U, 2199777653U, 312000287U}, // ID_CAP_REBOOT_FLASHING_MODE
+    {2811238511U, 2630953397U, 1753916443U, 3609499826U, 2281531683U, 3857172754U, 3614995491U, 1498760025U}, // ID_CAP_REMEMBER_ADMIN
+    {960448228U, 124837381U, 2563483041U, 469891198U, 4100770813U, 2729644340U, 3503047392U, 1355429414U}, // ID_CAP_REMEMBER_API
+    {668139856U, 3942372415U, 834492617U, 2206027386U, 4142474725U, 66990122U, 3772592193U, 3235399837U}, // ID_CAP_REMOVABLE_STORAGE
+    {3119417572U, 2277775852U, 1626501477U, 3450040177U, 2684904944U, 2756189738U, 1231471184U, 3044409550U}, // ID_CAP_RESET_PHONE
+    {3767036380U, 2452573463U, 2915228690U, 2136733997U, 2036960786U, 2577741598U, 1529076565U, 313898240U}, // ID_CAP_RESOURCE_MANAGER
+    {2778989464U, 3606603284U, 1425972647U, 2514550578U, 3586509582U, 3261444934U, 850304338U, 4013653183U}, // ID_CAP_RETAILDEMO_BACKGROUNDIMAGE
+    {2745706742U, 1955063667U, 4027566326U, 1592641635U, 1803131328U, 3980509628U, 3463523326U, 1140846690U}, // ID_CAP_RETAILDEMO_CLIENT
+    {586373818U, 2786069756U, 1542558694U, 2430743956U, 2663909577U, 459838596U, 3352703257U, 3315834698U}, // ID_CAP_RETAILDEMO_GLOB_REGISTRY
+    {3107518054U, 121342719U, 1646822783U, 2853351764U, 441338625U, 3508733821U, 139548560U, 2125483853U}, // ID_CAP_RETAILDEMO_OFFLINECONTENT
+    {3974642852U, 1571372058U, 4159005296U, 1467246296U, 2807880853U, 3789317012U, 1707856622U, 2183692766U}, // ID_CAP_RINGTONE_ADD
+    {3286512930U, 2104113511U, 776169894U, 3774931132U, 1481479886U, 2679856876U, 3763471432U, 1320927836U}, // ID_CAP_ROAMING_CONFIGURATION
+    {2697509677U, 3562892137U, 2520345939U, 3145480182U, 2943594840U, 2899422242U, 4148452379U, 2348924943U}, // ID_CAP_ROTATION_MANAGER
+    {2605919901U, 2028505803U, 2616249472U, 1916951566U, 2429234122U, 670920067U, 1637099775U, 293743863U}, // ID_CAP_RUNTIME_CONFIG
+    {1848794505U, 1539159629U, 1871611947U, 1251676914U, 485710209U, 609345724U, 3609089605U, 3774113151U}, // ID_CAP_SCREENCAPTURE
+    {3681416758U, 3923958136U, 695973463U, 967090356U, 1023589011U, 667602946U, 2720231792U, 2874285193U}, // ID_CAP_SCREEN_RECORDER
+    {1742502756U, 2084942211U, 3441620769U, 1644234786U, 3971719317U, 1862018027U, 2570039919U, 3620652526U}, // ID_CAP_SCREEN_RECORDER_BKG
+    {3705955382U, 2687187824U, 198155538U, 2126119446U, 3951291341U, 2497300154U, 2574559624U, 3570553757U}, // ID_CAP_SEARCHMAPS_SHAREDCONFIG
+    {3556700950U, 966883876U, 2119994786U, 835570158U, 4186075173U, 3321566178U, 2342780504U, 112422366U}, // ID_CAP_SEND_TO_ONENOTE
+    {894702801U, 1859710393U, 940606919U, 2487237098U, 2036547730U, 4046982941U, 3141396038U, 1818075930U}, // ID_CAP_SENSORS
+    {1054739705U, 2344687412U, 3568532035U, 2283427078U, 157244973U, 759021052U, 568658869U, 2716908597U}, // ID_CAP_SETDEVICENAME
+    {2427587499U, 746265140U, 4197375139U, 43976045U, 1292382866U, 3210384014U, 185107289U, 13440002U}, // ID_CAP_SETTINGSYNC
+    {4107885954U, 3716185742U, 3224104934U, 1187995184U, 1385456426U, 4146828806U, 1301940450U, 2042614762U}, // ID_CAP_SETTINGSYNC_CONFIGURATION
+    {2267846761U, 3652167981U, 553647163U, 3516993597U, 1653800410U, 782072134U, 1504010237U, 3294492881U}, // ID_CAP_SETTINGS_MANAGEMENT_PROVIDER
+    {1128246136U, 365952284U, 215699971U, 148956502U, 1240748635U, 1079928833U, 1554293643U, 2607006146U}, // ID_CAP_SHARED_OBJECT_DIRECTORY
+    {2601028688U, 1400909527U, 309619950U, 1487860706U, 2042211356U, 3982927395U, 4209023184U, 4176575247U}, // ID_CAP_SHARED_USER_CERTIFICATES
+    {2607041781U, 105400294U, 931728278U, 1249740349U, 2184341645U, 1865696420U, 2620492605U, 166280151U}, // ID_CAP_SHARE_DELEGATE
+    {341400343U, 1616620255U, 1379272012U, 2215826939U, 3441876558U, 4070683511U, 1462915037U, 1808767397U}, // ID_CAP_SHELL_DEVICE_LOCK_UI_API
+    {586922898U, 2075895408U, 1411270192U, 2671636579U, 969246145U, 3484573908U, 234972015U, 856650593U}, // ID_CAP_SHELL_LAUNCH_SESSION
+    {459277962U, 170024272U, 3490928234U, 2979052266U, 451014435U, 3757575450U, 1233373492U, 803577650U}, // ID_CAP_SHELL_NAVIGATION
+    {2337451890U, 1865582629U, 231446391U, 1725049013U, 988181085U, 1064791386U, 1119752906U, 2873223052U}, // ID_CAP_SHELL_NOTIFICATION_CLIENT
+    {2203887919U, 4246438731U, 4245180999U, 4283172919U, 2340055564U, 1451056652U, 4277460884U, 2208404897U}, // ID_CAP_SHELL_OEM_ADMIN
+    {3527194039U, 572934455U, 775768958U, 3763392049U, 3319281739U, 2988155326U, 4182862322U, 3449920013U}, // ID_CAP_SHELL_RESET_NAVIGATION
+    {128241636U, 3307902247U, 2817285140U, 735132217U, 2312911277U, 4205809206U, 1007611369U, 3710680900U}, // ID_CAP_SHELL_TEST_CLIENT
+    {195345289U, 1916222243U, 719600493U, 4220986442U, 3702103107U, 831528560U, 2223520357U, 1885368309U}, // ID_CAP_SHOW_VOLUME_CONTROL
+    {2837814457U, 446838958U, 4134203363U, 3154618340U, 3806605380U, 2087284607U, 1631047062U, 833954437U}, // ID_CAP_SMS
+    {224192147U, 1647023889U, 1456540092U, 4040574103U, 3006085188U, 2726105451U, 249856595U, 360392180U}, // ID_CAP_SMS_COMPANION
+    {1619915329U, 767272629U, 3035824254U, 1260436064U, 142962605U, 2206985418U, 2539139101U, 350820049U}, // ID_CAP_SMS_INTERCEPT_AGENT
+    {4016738814U, 1955307875U, 4281734135U, 3555921050U, 1308037760U, 503627744U, 4071514305U, 238101970U}, // ID_CAP_SMS_INTERCEPT_RECIPIENT
+    {3088484153U, 305556632U, 2650074917U, 3352569615U, 3870522476U, 76631359U, 1413047221U, 2993953468U}, // ID_CAP_SOUND_CONTROL
+    {2735174199U, 4247224082U, 1597245716U, 112696005U, 3212664062U, 1348314186U, 3750674045U, 3802821443U}, // ID_CAP_SPEECH_GRAMMARS
+    {3535090683U, 1467790171U, 3683719553U, 3624199220U, 916717644U, 438675671U, 3648676404U, 4113263664U}, // ID_CAP_SPEECH_RECOGNITION
+    {2846054301U, 2534429273U, 3723715993U, 1728552010U, 1338545801U, 3148967222U, 3628011301U, 3693733077U}, // ID_CAP_SPEECH_RECOGNITION_SYSTEM
+    {3879701980U, 2986429679U, 2371327785U, 3842365063U, 186255825U, 910705238U, 4224693043U, 3507114653U}, // ID_CAP_SPEECH_SETTINGS
+    {646298778U, 3199239359U, 3008431644U, 1046002542U, 1923125566U, 55209111U, 2175085899U, 707074146U}, // ID_CAP_SPEECH_UPDATE
+    {3919938835U, 2933956364U, 1380416994U, 3749268767U, 1973550014U, 959549438U, 450452208U, 1211797886U}, // ID_CAP_SPLASH_CONFIG
+    {888614017U, 1405439185U, 1347356837U, 1468645343U, 2595212279U, 3097397038U, 1568056746U, 1575295029U}, // ID_CAP_STARTMENU_CONFIG
+    {2312163180U, 3907364612U, 1791099509U, 2361854400U, 2875950616U, 4273782739U, 2484410821U, 3641475072U}, // ID_CAP_STORAGE_MANAGEMENT
+    {2761158735U, 2028465939U, 520306464U, 1780722689U, 2343629302U, 261837627U, 1709310277U, 266276999U}, // ID_CAP_SUPPRESS_MSA_CONNECT_ARD
+    {1205308923U, 455456419U, 3563239602U, 2512184885U, 1713697228U, 3256533572U, 3876253951U, 4178915363U}, // ID_CAP_SYNC_EXTENSION
+    {4025539208U, 2394182412U, 3665678535U, 1424508680U, 587899016U, 2627545747U, 1185390124U, 3626693348U}, // ID_CAP_SYSTEMTRAY_ADMIN
+    {3258601125U, 2427683295U, 3037576761U, 1471167596U, 3019208459U, 398100254U, 1843972914U, 1229678866U}, // ID_CAP_SYSTEM_ALLOC_WINDOWID
+    {2772979002U, 1706116018U, 2550500585U, 3031323619U, 4106578731U, 1216361816U, 3959319820U, 3727325269U}, // ID_CAP_SYSTEM_COMPOSITOR
+    {1913374562U, 3195220476U, 2912288353U, 4256722724U, 2370057973U, 1457864107U, 616163060U, 4283528709U}, // ID_CAP_SYSTEM_COUNTERS
+    {3529259054U, 693913535U, 2502525446U, 2356270295U, 440525008U, 533313454U, 119302349U, 3481226655U}, // ID_CAP_SYSTEM_REGISTRAR
+    {454091155U, 715092148U, 1936458702U, 714591068U, 1449827583U, 2962869081U, 2955151555U, 681894927U}, // ID_CAP_SYSTEM_WAITCURSOR
+    {4255666143U, 1041868521U, 2810925777U, 1851531193U, 881878350U, 2185342854U, 1190636781U, 526370508U}, // ID_CAP_TELEMETRY_ADMIN
+    {3758790050U, 1098763866U, 409658466U, 1290007948U, 3381367864U, 119475505U, 673337539U, 928496103U}, // ID_CAP_TELEMETRY_CONFIGURE
+    {2431839632U, 2577023175U, 3420314292U, 3456497880U, 733806331U, 2894493103U, 1171837811U, 3072005256U}, // ID_CAP_TELEMETRY_STUDY
+    {2924950472U, 2996500796U, 2307082749U, 1568609809U, 1405840275U, 1419194553U, 1103440866U, 2286264851U}, // ID_CAP_TEST_NAVIGATION
+    {3498766289U, 1752443994U, 3708231901U, 989869125U, 2505011435U, 3884157650U, 1315978408U, 3734161061U}, // ID_CAP_TILERESTOREDATA
+    {255448367U, 605612240U, 1670378437U, 2841375856U, 397265853U, 1417642585U, 2665013689U, 578561356U}, // ID_CAP_TOUCH
+    {2043118055U, 1660937372U, 1760295771U, 23001125U, 4123768582U, 2542299099U, 179048453U, 3995320372U}, // ID_CAP_TOUCH_TEST
+    {701820295U, 1719202734U, 2982983246U, 3459181053U, 1989146076U, 1264491859U, 613965645U, 1953312053U}, // ID_CAP_TPM_VSCMANAGER
+    {1181515144U, 3694836878U, 2741228614U, 1815774408U, 4179666529U, 4076015505U, 4121245909U, 1357839547U}, // ID_CAP_TS_SCHEDULES_ALL
+    {3341945687U, 85529345U, 3664973523U, 1010051450U, 1630652010U, 1124994769U, 4074068333U, 542386965U}, // ID_CAP_USB
+    {4260046235U, 1918750347U, 1973672567U, 1621588382U, 1482781861U, 325684403U, 486092017U, 2041679643U}, // ID_CAP_USER_ACTIVITY
+    {1033511018U, 1822759248U, 1978675957U, 1643708290U, 4229251492U, 667841080U, 3971149696U, 808357666U}, // ID_CAP_VIDEOSINK_INTERNAL
+    {888132005U, 3448019340U, 158356726U, 3167060666U, 2617767706U, 1045037197U, 1340612081U, 1516862962U}, // ID_CAP_VOICEMAIL
+    {1095573762U, 3316101978U, 2022247834U, 2111809451U, 3987745090U, 1723769045U, 1076307134U, 4157479128U}, // ID_CAP_VOIP
+    {2657401801U, 2918572790U, 2817216769U, 2779471173U, 1793032563U, 1449312528U, 269134460U, 2770226695U}, // ID_CAP_VOIP_CALL_CONTROLLER
+    {50897116U, 1806242603U, 3006338184U, 3115873503U, 2478008374U, 3306358596U, 1758746118U, 3101274807U}, // ID_CAP_VSTEST_INSTALL_FOLDER
+    {1419002827U, 3045150687U, 849488349U, 3802312663U, 1498001892U, 3098869541U, 3227875572U, 616546729U}, // ID_CAP_W32TIME_API
+    {3450627587U, 3500949094U, 3015895069U, 2060514397U, 4137301598U, 1879330820U, 4055232919U, 1470326601U}, // ID_CAP_WAB_RESOURCES
+    {1132648431U, 652232442U, 2510657139U, 221530666U, 1093305313U, 2143138099U, 2249097044U, 1024050389U}, // ID_CAP_WALLET
+    {1314380931U, 3989923313U, 3249193833U, 1963115619U, 3940350845U, 1282913705U, 2904921893U, 3519892189U}, // ID_CAP_WALLET_ADMIN
+    {1701033769U, 137094913U, 3738083205U, 577272984U, 1204217555U, 1180762924U, 3352773070U, 2589626690U}, // ID_CAP_WALLET_DEALS
+    {1071284118U, 3523478921U, 2250086196U, 3560449695U, 2200277944U, 2152682759U, 979385846U, 2597897782U}, // ID_CAP_WALLET_PAYMENTINSTRUMENTS
+    {2574699830U, 3181185929U, 3027770695U, 909065751U, 3082512267U, 3559348174U, 3315132573U, 1163471962U}, // ID_CAP_WALLET_SECUREELEMENT
+    {3794396841U, 2796053954U, 115778455U, 3480603257U, 3921638602U, 1435079522U, 1181627245U, 1104944796U}, // ID_CAP_WALLPAPER_ADMIN
+    {4195170007U, 3217416718U, 408606996U, 1215698218U, 3843642158U, 2328682911U, 1956890848U, 3247165808U}, // ID_CAP_WBOEXT
+    {3710790608U, 1464126134U, 2011855470U, 2451533004U, 964704134U, 1797798242U, 1092047362U, 3684262004U}, // ID_CAP_WEBBROWSERCOMPONENT
+    {2720926852U, 3985360349U, 1076280333U, 2472745645U, 972265978U, 3854372980U, 2790955482U, 1237008696U}, // ID_CAP_WEB_CREDENTIALS
+    {440652535U, 2732821954U, 2967096804U, 2743102374U, 560164511U, 4036865778U, 1144947683U, 2219429793U}, // ID_CAP_WIFI_ADMIN
+    {683259718U, 3451203448U, 3339750839U, 4227422354U, 133059296U, 3103485949U, 1925116620U, 1722723162U}, // ID_CAP_WIFI_BASIC
+    {2324933716U, 2956100434U, 4219743502U, 1086821030U, 3812704970U, 2422414750U, 878115116U, 1667648065U}, // ID_CAP_WIFI_BROWSER
+    {2838927708U, 2070449754U, 1304848856U, 2028849301U, 358321552U, 2227845149U, 3853260091U, 658834658U}, // ID_CAP_WIFI_HOTSPOT_HOST
+    {4054819066U, 802391600U, 1203984480U, 2463650894U, 3336624440U, 45135620U, 2726068655U, 3845894840U}, // ID_CAP_WIFI_PROFILE_ADMIN
+    {3016363324U, 211487058U, 2289367980U, 625093705U, 4253951293U, 509245108U, 1154031315U, 2142883203U}, // ID_CAP_WIFI_TILE_MANAGER
+    {1897905913U, 3156468556U, 2798359476U, 3140430944U, 429555755U, 1449344379U, 229829512U, 1303529462U}, // ID_CAP_WPN_PLATFORM
+    {2776066945U, 3587586217U, 1820852381U, 2593702941U, 53257123U, 69866954U, 901192403U, 2294580339U}, // ID_CAP_WPN_PLATFORM_REG_KEY
+    {670527361U, 4270065953U, 442862738U, 3755418335U, 1291780350U, 255240843U, 28775031U, 2873517487U}, // ID_CAP_WPTOOLS_INSTALL_FOLDER
+    {2108181710U, 3990930931U, 3595162611U, 4117497009U, 1326642875U, 3084868306U, 1753940881U, 3334367291U}, // ID_CAP_ZMFSERVICES
+    {1516196777U, 2336187826U, 3588042469U, 1597350212U, 3633128727U, 3627081447U, 3987028236U, 1309635281U}, // ID_CAP_ZTRACE
+    {3587299478U, 3639007516U, 3814668116U, 3504216910U, 3288238490U, 4152770330U, 3776762357U, 4137276808U}, // Microsoft.firmwareRead_cw5n1h2txyewy
+    {167150616U, 1275062348U, 2713805091U, 2778296164U, 3974222648U, 2164638478U, 1020776486U, 555832402U}, // Microsoft.firmwareWrite_cw5n1h2txyewy
+    {1069651245U, 2375841711U, 1570187833U, 1826699927U, 1726783584U, 1420246439U, 936999711U, 2864509111U}, // accessoryManager
+    {1619559953U, 3382903645U, 900470658U, 1831728285U, 1265525240U, 911141481U, 3610949621U, 2233473754U}, // activateAsUser
+    {4191902497U, 1978494743U, 2749246665U, 3072910927U, 102050379U, 1373940514U, 1865125746U, 920055924U}, // activity
+    {2946685888U, 1412457410U, 1274547043U, 2288208346U, 1419295423U, 4263087484U, 1197735815U, 185032629U}, // activityData
+    {1162883296U, 1069378821U, 326368785U, 1434266408U, 2276863517U, 33602275U, 954297818U, 703384370U}, // activitySystem
+    {739809946U, 31981425U, 3357933805U, 1069317161U, 1095314212U, 1881123208U, 2517158727U, 2838317017U}, // allAppMods
+    {3804131010U, 705767314U, 2184915385U, 1233717497U, 4177653708U, 4048234552U, 2488388519U, 2361358067U}, // allJoyn
+    {3190844328U, 4099963570U, 3870079217U, 2969588245U, 2822710570U, 1600598934U, 3576592281U, 2616761512U}, // allowElevation
+    {1711161832U, 2391198485U, 820063299U, 1370696258U, 386833486U, 159980468U, 2370099864U, 3003935251U}, // appBroadcast
+    {2926717412U, 422488402U, 1366096836U, 1344602270U, 1873175643U, 1473303204U, 936893394U, 2894442738U}, // appBroadcastServices
+    {3476374539U, 3039849540U, 366645324U, 2483637467U, 1772423258U, 1707465968U, 3111864834U, 3269078184U}, // appBroadcastSettings
+    {1463147068U, 3371832618U, 1388101890U, 3973589861U, 2607976136U, 547912034U, 117841509U, 208667311U}, // appCaptureServices
+    {658842318U, 317372455U, 4011887121U, 1811749129U, 3600856248U, 3713732611U, 2239025110U, 3453100640U}, // appCaptureSettings
+    {2263946659U, 221263054U, 3004297223U, 2509109377U, 4006057435U, 143953683U, 28675390U, 302247413U}, // appDiagnostics
+    {2889647217U, 2665888344U, 755061017U, 1229970740U, 3900060832U, 776474665U, 3655643929U, 4127345024U}, // appLicensing
+    {881369057U, 2832504344U, 3519039658U, 1339685250U, 2577216982U, 4012114432U, 3791153993U, 395796043U}, // appManagementSystem
+    {2307497680U, 4012621616U, 2010379297U, 3343964328U, 2052510818U, 1748739893U, 1212548257U, 3431941134U}, // applicationDefaults
+    {2898197306U, 3300330394U, 3003314763U, 2509405055U, 2905551251U, 1957103989U, 1590147722U, 3620397556U}, // applicationViewActivation
+    {3206565827U, 2991827804U, 2894052746U, 2323054194U, 1177664632U, 1286603069U, 1189849485U, 1972712703U}, // appointments
+    {2643354558U, 482754284U, 283940418U, 2629559125U, 2595130947U, 547758827U, 818480453U, 1102480765U}, // appointmentsSystem
+    {883896814U, 3354213294U, 3301286982U, 317704133U, 585371054U, 1013261047U, 3043375309U, 4225165118U}, // audioDeviceConfiguration
+    {4106739713U, 2202381260U, 889751371U, 2542076894U, 949314626U, 2070158488U, 1307026530U, 1634293246U}, // automatedAppLaunch
+    {2534516097U, 1142442286U, 655920092U, 1743268574U, 1314016795U, 1429942190U, 2819395560U, 270754105U}, // backgroundMediaPlayback
+    {3600989948U, 23999185U, 244315476U, 3249032439U, 1572071926U, 2693423960U, 1756015955U, 476862173U}, // backgroundMediaRecording
+    {430053105U, 4032735609U, 1171668343U, 1645936470U, 2638819442U, 1416532308U, 1601544585U, 3837596276U}, // backgroundSpatialPerception
+    {1608535222U, 2236177337U, 2273647247U, 4285317194U, 64076989U, 4056796171U, 3520552447U, 587742984U}, // backgroundVoIP
+    {3149641346U, 2023381965U, 1268122805U, 208697403U, 105048083U, 4278001374U, 1912745317U, 54431807U}, // biometricSystem
+    {1615643396U, 3082447698U, 3017968123U, 3374415059U, 2610093431U, 2583988378U, 2307023373U, 470284681U}, // blockedChatMessages
+    {3695299237U, 4278247513U, 1402175595U, 525333027U, 1997893985U, 119680826U, 3080251162U, 2948828488U}, // bluetooth
+    {1727386112U, 3145810323U, 3431268083U, 3689970327U, 739836844U, 3616656621U, 880051228U, 1594631605U}, // bluetooth.genericAttributeProfile
+    {192337609U, 3775446108U, 269428844U, 3253752169U, 951748958U, 3578505117U, 3621846901U, 2918023745U}, // bluetooth.rfcomm
+    {4045220798U, 4006817410U, 2009534922U, 2349621079U, 2856184499U, 1580556691U, 4033646817U, 3656330790U}, // bluetoothAdapter
+    {1100675591U, 2533292760U, 1453534270U, 493659277U, 2124548245U, 453423080U, 3673526281U, 1287615703U}, // bluetoothDeviceSettings
+    {1974458983U, 3751645300U, 1729349480U, 143855079U, 3029832425U, 4231518528U, 3654703415U, 3501943311U}, // bluetoothSync
+    {409184936U, 3492136685U, 1247900983U, 2581887906U, 3579752202U, 163677003U, 4103108149U, 3681389169U}, // bootstrapNetworkConnection
+    {3247244612U, 4072385457U, 573406302U, 3159362907U, 4108726569U, 214783218U, 394353107U, 2658650418U}, // broadFileSystemAccess
+    {1786727007U, 1419438852U, 1346871473U, 886967802U, 2322011002U, 2056872840U, 2554717053U, 428674754U}, // browserAppList
+    {3826530540U, 457977918U, 831996869U, 4121746106U, 3747742610U, 578447321U, 1227403828U, 2925310924U}, // browserCredentials
+    {1769135850U, 3630014969U, 1076440520U, 3467250754U, 2559601130U, 3896137046U, 598179284U, 2520253561U}, // cameraProcessingExtension
+    {4202252877U, 2865353318U, 2163093313U, 1255794810U, 793861730U, 357389790U, 2203944137U, 1979881144U}, // capabilityAccessConsentDeviceSettings
+    {2732930991U, 1716039000U, 1394599507U, 3926803129U, 3068501044U, 2027633224U, 866606239U, 446136062U}, // cellularData
+    {3523901360U, 1745872541U, 794127107U, 675934034U, 1867954868U, 1951917511U, 1111796624U, 2052600462U}, // cellularDeviceControl
+    {11742800U, 2107441976U, 3443185924U, 4134956905U, 3840447964U, 3749968454U, 3843513199U, 670971053U}, // cellularDeviceIdentity
+    {3659434007U, 2290108278U, 1125199667U, 3679670526U, 1293081662U, 2164323352U, 1777701501U, 2595986263U}, // cellularMessaging
+    {1843664571U, 2624890912U, 906393051U, 1078660739U, 2972153046U, 2454524471U, 519964814U, 2587554601U}, // chat
+    {2210865643U, 3515987149U, 1329579022U, 3761842879U, 3142652231U, 371911945U, 4180581417U, 4284864962U}, // chatSystem
+    {2440306377U, 3304611049U, 1494399071U, 1161926223U, 163912384U, 1437065773U, 1456820560U, 2390158196U}, // childWebContent
+    {3424233489U, 972189580U, 2057154623U, 747635277U, 1604371224U, 316187997U, 3786583170U, 1043257646U}, // chromeInstallFiles
+    {4043583521U, 4256083701U, 1687135424U, 4293105506U, 3284195402U, 1880287749U, 1981697668U, 1245952579U}, // cloudExperienceHost
+    {3035980445U, 2343077072U, 2039973919U, 2593655016U, 2336600711U, 3402322490U, 2613491542U, 1611519126U}, // cloudStore
+    {3802075078U, 3056353928U, 831493480U, 1656114792U, 3017467262U, 3614159431U, 110502994U, 2980336225U}, // codeGeneration
+    {3079670389U, 2007748205U, 2562610427U, 601937422U, 2520430104U, 385621523U, 2626497331U, 2704537329U}, // comPort
+    {2570221383U, 1448989026U, 3001874883U, 2650828016U, 3583537604U, 1222031009U, 3645131881U, 3559315223U}, // componentUiInWebContent
+    {719903687U, 4232398539U, 3510704256U, 4190309334U, 1296461745U, 392634193U, 3994393407U, 3122493104U}, // confirmAppClose
+    {1604681682U, 535129537U, 3273749797U, 3666938095U, 336295784U, 2177615760U, 2743807136U, 2867270584U}, // constrainedImpersonation
+    {3940324700U, 2858494370U, 2345038474U, 1357291012U, 3714428700U, 1390950899U, 1148638500U, 3083056261U}, // contacts
+    {2897291008U, 3029319760U, 3330334796U, 465641623U, 3782203132U, 742823505U, 3649274736U, 3650177846U}, // contactsSystem
+    {4110201754U, 1809691228U, 1538346907U, 3864242205U, 2028988089U, 3700273171U, 2753247048U, 3183731716U}, // contentDeliveryManagerSettings
+    {1153741845U, 4055335118U, 1225664883U, 195292590U, 1759808002U, 1431092349U, 2272129516U, 1486240673U}, // contentRestrictions
+    {2165721414U, 884371012U, 2773947476U, 2437641138U, 4209659587U, 972658821U, 4033014341U, 190168586U}, // coreShell
+    {3275915203U, 3073501320U, 309536135U, 1674744297U, 1740689076U, 4251230105U, 810187298U, 4091229748U}, // cortanaPermissions
+    {1216833578U, 114521899U, 3977640588U, 1343180512U, 2505059295U, 473916851U, 3379430393U, 3088591068U}, // cortanaSettings
+    {2393506754U, 775327057U, 2499928852U, 1629457672U, 3431788399U, 3853256447U, 4267427883U, 2817119566U}, // cortanaSpeechAccessory
+    {62839846U, 501466537U, 2290531897U, 2759907144U, 790738421U, 810669360U, 297897068U, 329083804U}, // cortanaSurface
+    {2761669778U, 346687544U, 888879415U, 1068145723U, 1713973600U, 1619522427U, 2554995326U, 316594194U}, // curatedTileCollections
+    {3507210475U, 1388726999U, 495431498U, 661836165U, 78720062U, 3345250209U, 313768747U, 1276603351U}, // customInstallActions
+    {3091062438U, 3596320077U, 788891217U, 2782159909U, 2069850133U, 879116102U, 973189406U, 4197634097U}, // dateAndTimeDeviceSettings
+    {3632359879U, 3209770303U, 1264712472U, 2987632071U, 4029161013U, 2743820849U, 2346022090U, 2809393155U}, // dependencyTarget
+    {2897910012U, 1573455959U, 200501331U, 2568813761U, 2319087266U, 988733333U, 3857432473U, 3189972763U}, // developerSettings
+    {2579371802U, 50273823U, 2532007077U, 778130756U, 637227457U, 1650229637U, 1599285538U, 2684141260U}, // developmentModeNetwork
+    {2239652689U, 2664391391U, 2534113880U, 4255263305U, 2927724023U, 983973769U, 3561532285U, 1967325175U}, // deviceEncryptionManagement
+    {940827362U, 2949684522U, 1275981294U, 3378921087U, 3884907310U, 1905252139U, 2180543584U, 691417712U}, // deviceIdentityManagement
+    {1347429957U, 3987483571U, 1984428752U, 1885250686U, 25866997U, 3084422878U, 1348532569U, 983810561U}, // deviceLockManagement
+    {1813308025U, 3893443517U, 2936766468U, 3261773091U, 2430119119U, 317633435U, 1602637770U, 2843472530U}, // deviceManagementAdministrator
+    {1447750909U, 3412137041U, 2543229612U, 2579680811U, 949383960U, 1512208256U, 1474305305U, 1405036652U}, // deviceManagementDeviceLockPolicies
+    {2830772650U, 3846338416U, 1816072262U, 3095855940U, 4193335384U, 2293034769U, 252220343U, 157514922U}, // deviceManagementDmAccount
+    {917207464U, 68434614U, 1080454720U, 3650237274U, 2024810623U, 3125538881U, 3710571513U, 3065818052U}, // deviceManagementEmailAccount
+    {2114238718U, 839519356U, 3141599949U, 1701592612U, 4239813495U, 2246009235U, 3401969156U, 562141158U}, // deviceManagementFoundation
+    {150999393U, 257915958U, 2109302476U, 342821789U, 1525132724U, 4026398146U, 564805607U, 440935315U}, // deviceManagementRegistration
+    {3057529725U, 2845346375U, 3525973929U, 2302649945U, 3073475876U, 347241512U, 4167996218U, 3915214886U}, // deviceManagementWapSecurityPolicies
+    {676841816U, 1149237631U, 4032147681U, 1035363705U, 1749014660U, 2240504816U, 969164111U, 1508678073U}, // devicePortalProvider
+    {989523358U, 1667815365U, 316973287U, 129935811U, 3358257576U, 2796868252U, 2781088163U, 715581871U}, // deviceProvisioningAdministrator
+    {3090417596U, 1177152433U, 709977159U, 3759866339U, 3648116925U, 1194977332U, 3459169701U, 1652573254U}, // deviceUnlock
+    {3276485077U, 3589353304U, 4129381419U, 1100299628U, 406867830U, 2425660980U, 2594398395U, 148359903U}, // diagnostics
+    {3996567031U, 2672614U, 524480011U, 1692915980U, 260182050U, 3211622006U, 2077298474U, 2793490206U}, // displayDeviceSettings
+    {4090599227U, 2031128978U, 4197150514U, 3106696474U, 3598308373U, 297001435U, 2835591233U, 1745192457U}, // documentsLibrary
+    {531085349U, 3971269601U, 1024280280U, 4054111094U, 4029683689U, 912804737U, 715231967U, 2563861597U}, // dualSimTiles
+    {3213385057U, 1002943098U, 1723051927U, 1419152406U, 3870126442U, 848894659U, 559664656U, 2364677135U}, // email
+    {2357373614U, 1717914693U, 1151184220U, 2820539834U, 3900626439U, 4045196508U, 2174624583U, 3459390060U}, // emailSystem
+    {1254246026U, 2307176119U, 3817577965U, 2076242866U, 2452291298U, 4213526789U, 1884648706U, 2393659593U}, // enterpriseAuthentication
+    {983922258U, 2159917625U, 2751362240U, 3284369410U, 2497023943U, 943411171U, 3503282929U, 3741434461U}, // enterpriseCloudSSO
+    {373139346U, 748750918U, 1948434659U, 2643498477U, 4072104851U, 1007166015U, 1979446734U, 3878125657U}, // enterpriseDataPolicy
+    {1720708008U, 676358685U, 3694961389U, 3536049837U, 28312851U, 1003502039U, 653286243U, 2922628565U}, // enterpriseDeviceLockdown
+    {2902294132U, 2765181373U, 854371626U, 2195433701U, 590439919U, 3431881116U, 543403436U, 2715691291U}, // eraApplication
+    {2031129053U, 1104036981U, 335214479U, 1704595805U, 1750505959U, 454379672U, 2676751368U, 273525052U}, // exclusiveResource
+    {2260126382U, 343122119U, 3503137940U, 547812879U, 2608166238U, 1729045573U, 3394722501U, 2075048815U}, // expandedResources
+    {366303795U, 2616852666U, 3636748606U, 1444657452U, 4092942175U, 931406372U, 2783367388U, 2252851075U}, // extendedBackgroundTaskTime
+    {1757733230U, 3792965022U, 4183625483U, 1509180916U, 2800675197U, 3882158587U, 2291756888U, 318020845U}, // extendedExecutionBackgroundAudio
+    {1129237768U, 79454143U, 2136254559U, 1623985096U, 3814653484U, 63270843U, 875342860U, 3699824235U}, // extendedExecutionCritical
+    {374222737U, 2106488203U, 813473153U, 3732709437U, 2286922564U, 1719656165U, 2804691494U, 2247406137U}, // extendedExecutionUnconstrained
+    {1045063015U, 423899465U, 3012769174U, 65638258U, 1865874412U, 2349348127U, 763856749U, 1075684855U}, // featureStagingInfo
+    {1124026668U, 2590638337U, 403184773U, 3888676922U, 1161809615U, 3294960644U, 2573571652U, 4073547852U}, // feedbackLogCollection
+    {1915131181U, 1661839130U, 3466558662U, 2365313265U, 168482886U, 3910651210U, 2178004652U, 3294308643U}, // firstSignInSettings
+    {4134329593U, 2783901983U, 2229587954U, 3094154347U, 3627794263U, 3584176859U, 1146258567U, 3226826104U}, // flashPlayerSupport
+    {3777909873U, 1799880613U, 452196415U, 3098254733U, 3833254313U, 651931560U, 4017485463U, 3376623984U}, // fullFileSystemAccess
+    {449500426U, 4112254358U, 3456904286U, 1727260714U, 2501084857U, 171973213U, 3131658879U, 2198086578U}, // gameBarServices
+    {401877177U, 3224070873U, 2323497442U, 1003973387U, 3084573282U, 2711758241U, 819722521U, 4059117567U}, // gameConfigStoreManagement
+    {2845449227U, 614308480U, 78272248U, 3394209543U, 1591752031U, 1559218649U, 93556750U, 3923753255U}, // gameList
+    {904812328U, 3382336523U, 604674363U, 3566595458U, 55181553U, 1647155837U, 3587023889U, 1434257878U}, // gameMonitor
+    {3999614906U, 2618500826U, 771955779U, 179454160U, 3146794842U, 978219881U, 1888059073U, 3547555565U}, // gamingContainerResources
+    {3376936998U, 3079131011U, 3493239218U, 4149829184U, 2165481223U, 457710256U, 1867388583U, 975281650U}, // gazeInput
+    {2090636495U, 3766770698U, 2683492325U, 2447499578U, 598008548U, 570169362U, 643700305U, 4067185823U}, // globalMediaControl
+    {955681297U, 3470559067U, 873149510U, 312866181U, 505149074U, 2965990245U, 3641224364U, 480676545U}, // graphicsCapture
+    {3631914340U, 188226977U, 3551325271U, 2255822655U, 4149116707U, 2222894358U, 109158049U, 3700719646U}, // hevcPlayback
+    {3112306483U, 3660621463U, 257260665U, 3486542839U, 2332589503U, 3487152257U, 2268758775U, 4227522996U}, // hfxSystem
+    {1956928088U, 1150472397U, 2484069381U, 3875382541U, 842779402U, 1827883220U, 3710319321U, 1517967199U}, // hidTelephony
+    {2535547787U, 2859156693U, 1909920036U, 495084244U, 1900230707U, 2688850151U, 824944487U, 2812335965U}, // holographicCompositor
+    {1602466680U, 3296347575U, 4127869923U, 2900434464U, 2561196862U, 49964291U, 1709077611U, 2367554900U}, // holographicCompositorSystem
+    {1046399399U, 2930200366U, 2987218432U, 2534044392U, 2246125859U, 3426736648U, 2380978411U, 3024971649U}, // humanInterfaceDevice
+    {1465311546U, 2257072239U, 668808861U, 147177181U, 4082675985U, 2606236256U, 3128464940U, 3339364813U}, // imeSystem
+    {214718993U, 498630924U, 2386791142U, 577439625U, 2810695033U, 1494250253U, 3518519070U, 3271338433U}, // inProcessMediaExtension
+    {724741592U, 1210917904U, 489960769U, 637019204U, 3345707629U, 3097053430U, 1727148295U, 85063603U}, // indexedContent
+    {700980291U, 3826703102U, 74257294U, 1944477230U, 3996044019U, 1710163232U, 669333698U, 3456870998U}, // inputForegroundObservation
+    {918685303U, 2392273179U, 1242551144U, 2277013827U, 3453391213U, 358261840U, 2217007564U, 611397587U}, // inputInjection
+    {3013640951U, 2064330411U, 254515802U, 3189253915U, 2864799581U, 3198640868U, 225261281U, 449094411U}, // inputInjectionBrokered
+    {3027914275U, 2211407940U, 856553809U, 632662545U, 1682185480U, 3508903257U, 964318829U, 733730950U}, // inputObservation
+    {290691043U, 1809104139U, 3779483415U, 4180028346U, 416543034U, 474041192U, 1165139072U, 3529661359U}, // inputSettings
+    {765387629U, 349433948U, 1457807909U, 617344056U, 1566752638U, 257569518U, 614478271U, 2332265213U}, // inputSuppression
+    {2779705173U, 1925339129U, 2667939958U, 2414465498U, 3395756507U, 4015878651U, 158944808U, 788332705U}, // internetClient
+    {309259276U, 1558928059U, 2828253251U, 1567535764U, 1640198682U, 3321378364U, 2265860830U, 2415090742U}, // internetClientServer
+    {3588549841U, 719077279U, 3941072665U, 3448285197U, 1036512782U, 3700459644U, 2560456231U, 1231893854U}, // interopServices
+    {3454965887U, 3290650400U, 2940896100U, 3597022628U, 555909890U, 266477235U, 2006854836U, 2653097966U}, // keyboardDeviceSettings
+    {2504670005U, 2976793830U, 4003121026U, 4148067134U, 1713612043U, 4071409127U, 3590382006U, 1961407663U}, // kinectAudio
+    {1742170943U, 636614655U, 566345436U, 671168881U, 221913238U, 1591444469U, 660231079U, 2846280225U}, // kinectExpressions
+    {2784946709U, 2480755460U, 597113710U, 353309690U, 2371995077U, 231819874U, 2895422829U, 2702751838U}, // kinectFace
+    {1181832740U, 12243858U, 3034171161U, 2856761475U, 3986326068U, 709165692U, 3600133598U, 3151914247U}, // kinectGamechat
+    {2351847339U, 3952159711U, 1321995659U, 1856695608U, 1876855382U, 3779947333U, 3567888192U, 1066310425U}, // kinectRequired
+    {2618385555U, 2203043339U, 3206394193U, 4202133921U, 1454837690U, 4121054217U, 161868357U, 1762783179U}, // kinectVideo
+    {3480132683U, 2418354375U, 3864436754U, 3567986673U, 4231847241U, 478638527U, 2019413052U, 106637949U}, // kinectVision
+    {770252753U, 1444666466U, 336377712U, 2873026788U, 52184070U, 1923451027U, 23849407U, 2228870135U}, // languageAndRegionDeviceSettings
+    {196535348U, 1508395381U, 528716610U, 1782869926U, 3623809819U, 1847309163U, 3382315171U, 2404341211U}, // languageSettings
+    {1941919063U, 976504945U, 3191785059U, 2835515153U, 1936800635U, 1519032070U, 1452055454U, 2678282739U}, // liveIdService
+    {2860943891U, 259454752U, 3991971624U, 1256951739U, 2310278415U, 1079264183U, 2380929058U, 3727145988U}, // localExperienceInternal
+    {3724309453U, 2359325875U, 2229763891U, 1974356874U, 3258006466U, 2042387340U, 619821221U, 1440898974U}, // localSystemServices
+    {1120341015U, 4059530845U, 270443254U, 1514536596U, 2315272569U, 284657971U, 419501928U, 776969430U}, // location
+    {3029335854U, 3332959268U, 2610968494U, 1944663922U, 1108717379U, 267808753U, 1292335239U, 2860040626U}, // locationHistory
+    {2587416013U, 1330314424U, 1690737965U, 1725259538U, 4126505581U, 1558002373U, 2875425159U, 3881190746U}, // locationSystem
+    {352835710U, 3145586182U, 2880647242U, 675368078U, 3441261668U, 1710821006U, 2032288639U, 3146782223U}, // lockScreenCreatives
+    {1234007056U, 2663856401U, 2070564919U, 154281843U, 2544581321U, 3321489116U, 4145095046U, 1431496914U}, // lowLevel
+    {2136653787U, 990173382U, 3730014305U, 3794374500U, 1001559012U, 3111233883U, 485923750U, 2526317185U}, // lowLevelDevices
+    {1502825166U, 1963708345U, 2616377461U, 2562897074U, 4192028372U, 3968301570U, 1997628692U, 1435953622U}, // lpacAppExperience
+    {2302894289U, 466761758U, 1166120688U, 1039016420U, 2430351297U, 4240214049U, 4028510897U, 3317428798U}, // lpacChromeInstallFiles
+    {4092130000U, 472000003U, 1670882671U, 259370826U, 3862510858U, 3415016346U, 1868891083U, 3396446831U}, // lpacClipboard
+    {2405443489U, 874036122U, 4286035555U, 1823921565U, 1746547431U, 2453885448U, 3625952902U, 991631256U}, // lpacCom
+    {3203351429U, 2120443784U, 2872670797U, 1918958302U, 2829055647U, 4275794519U, 765664414U, 2751773334U}, // lpacCryptoServices
+    {126078593U, 3658686728U, 1984883306U, 821399696U, 3684079960U, 564038680U, 3414880098U, 3435825201U}, // lpacEnterprisePolicyChangeNotifications
+    {79080987U, 3398622760U, 2608912076U, 1085899501U, 4039864605U, 4024366022U, 736258278U, 368603348U}, // lpacIME
+    {1788129303U, 2183208577U, 3999474272U, 3147359985U, 1757322193U, 3815756386U, 151582180U, 1888101193U}, // lpacIdentityServices
+    {3153509613U, 960666767U, 3724611135U, 2725662640U, 12138253U, 543910227U, 1950414635U, 4190290187U}, // lpacInstrumentation
+    {1692970155U, 4054893335U, 185714091U, 3362601943U, 3526593181U, 1159816984U, 2199008581U, 497492991U}, // lpacMedia
+    {1742180919U, 3973133362U, 3881819074U, 3076390979U, 3006877977U, 1258694795U, 2087530448U, 2333862241U}, // lpacPackageManagerOperation
+    {2922296261U, 1647482768U, 2017091146U, 3858667068U, 4135663662U, 2931985894U, 1627820925U, 818366431U}, // lpacPayments
+    {220022770U, 701261984U, 3991292956U, 4208751020U, 2918293058U, 3396419331U, 1700932348U, 2078364891U}, // lpacPnPNotifications
+    {4044835139U, 2658482041U, 3127973164U, 329287231U, 3865880861U, 1938685643U, 461067658U, 1087000422U}, // lpacPrinting
+    {528118966U, 3876874398U, 709513571U, 1907873084U, 3598227634U, 3698730060U, 278077788U, 3990600205U}, // lpacServicesManagement
+    {1864111754U, 776273317U, 3666925027U, 2523908081U, 3792458206U, 3582472437U, 4114419977U, 1582884857U}, // lpacSessionManagement
+    {3623855041U, 1826999956U, 3747069818U, 3525260223U, 3747374510U, 1746272624U, 950601168U, 56556331U}, // lpacWebPlatform
+    {3996699186U, 3595629362U, 3480063212U, 3905085333U, 2276303035U, 3068169911U, 3004821721U, 4252886170U}, // microphone
+    {2687912068U, 1527563483U, 2246345126U, 2445616054U, 2679617633U, 2814117500U, 2092001380U, 704615243U}, // microsoftEdgeRemoteDebugging
+    {3049152140U, 946229307U, 4003843583U, 1650663789U, 1490977625U, 1046559530U, 3243139619U, 975812231U}, // mixedRealityEnvironmentInternal
+    {1048653548U, 3880638403U, 2205339385U, 990407011U, 3754096113U, 1755676234U, 2344900531U, 1375370936U}, // mmsTransportSystem
+    {3647570423U, 1170909575U, 4194078310U, 4044586368U, 1349189231U, 3780358251U, 3939307736U, 2707571402U}, // modifiableApp
+    {4138369114U, 3747645054U, 3774339213U, 2277265673U, 300906310U, 2019405316U, 606661171U, 1835382214U}, // multiplaneOverlay
+    {642225045U, 1497410490U, 4133325371U, 1747563908U, 2253433576U, 3934691789U, 210245039U, 1860717921U}, // muma
+    {3863518393U, 3626451890U, 3669443474U, 1999530499U, 2406597458U, 1735372251U, 1080155281U, 741764760U}, // musicLibrary
+    {1904668343U, 1122143141U, 2896894936U, 1757704438U, 2225457261U, 1832870532U, 4083204921U, 4111087458U}, // networkConnectionManagerProvisioning
+    {4214965917U, 3375290950U, 3857009211U, 4120063080U, 3741332808U, 2868847822U, 1843154671U, 4148511555U}, // networkDataPlanProvisioning
+    {1077806553U, 3407786159U, 3143147184U, 1468041508U, 245664426U, 3461639803U, 3586422868U, 1013604766U}, // networkDataUsageManagement
+    {4254232129U, 3709064871U, 1821651845U, 2739656797U, 2804206191U, 3447631095U, 3000753041U, 3461212826U}, // networkDeviceSettings
+    {518545664U, 1612196034U, 3480841272U, 376121288U, 393698823U, 4139136808U, 95323593U, 1103535949U}, // networkDiagnostics
+    {1068037383U, 729401668U, 2768096886U, 125909118U, 1680096985U, 174794564U, 3112554050U, 3241210738U}, // networkingVpnProvider
+    {2169237947U, 275284851U, 3876357460U, 1273727642U, 1157490466U, 1177376558U, 883687086U, 945396102U}, // nfcSystem
+    {92225113U, 3361836817U, 3058429206U, 1312023296U, 1809529312U, 1859457108U, 3447665438U, 3544701957U}, // notificationsDeviceSettings
+    {1714402723U, 3681070311U, 1045646184U, 555837952U, 257600184U, 3998505355U, 63610276U, 3865718003U}, // objects3D
+    {1114507550U, 2235118486U, 1313240074U, 4283153625U, 597607960U, 2635661315U, 2827405174U, 912873668U}, // oemDeployment
+    {278763595U, 641296858U, 3665893476U, 2977301132U, 1926709684U, 2066268498U, 4151792040U, 2589241065U}, // oemPublicDirectory
+    {3456877387U, 2052140335U, 534762229U, 3699386062U, 2590405591U, 4011441432U, 2706472608U, 754907458U}, // offlineMapsManagement
+    {4048721701U, 2850658424U, 351864712U, 89823626U, 3166552844U, 1648129654U, 666764415U, 3345515861U}, // oneProcessVoIP
+    {1575399732U, 3056358718U, 2825064311U, 550644430U, 3464259740U, 2132227768U, 979495139U, 1077632175U}, // optical
+    {2854389722U, 2213348522U, 1345377226U, 1426673889U, 1057411476U, 1183484899U, 2204009092U, 773751949U}, // pacJsWorker
+    {3635283841U, 2530182609U, 996808640U, 1887759898U, 3848208603U, 3313616867U, 983405619U, 2501854204U}, // packageContents
+    {734518492U, 402359323U, 2580938124U, 1419864735U, 4212787651U, 2727913556U, 228323224U, 564805089U}, // packageManagement
+    {1074678882U, 1845519692U, 958031958U, 89677218U, 2730550528U, 3336438952U, 1306664337U, 3311493206U}, // packagePolicySystem
+    {1962849891U, 688487262U, 3571417821U, 3628679630U, 802580238U, 1922556387U, 206211640U, 3335523193U}, // packageQuery
+    {2962209256U, 2979070741U, 3173536111U, 2627411448U, 3810448907U, 2604541049U, 103961185U, 926209548U}, // packageWriteRedirectionCompatibilityShim
+    {2119561992U, 3910021631U, 2703022402U, 4024892384U, 119119367U, 1652639859U, 1663152375U, 2255428156U}, // packagedServices
+    {4094556557U, 3002736401U, 1971953794U, 2757521288U, 2231035381U, 3459874925U, 2997907580U, 1328483296U}, // perceptionMonitoring
+    {4261096351U, 406411886U, 1187434358U, 1445476386U, 2569006900U, 2217228443U, 3950610055U, 882844645U}, // perceptionSensorsExperimental
+    {34359262U, 2669769421U, 2130994847U, 3068338639U, 3284271446U, 2009814230U, 2411358368U, 814686995U}, // perceptionSystem
+    {3247294477U, 1055689029U, 3368529789U, 3941363664U, 2797964971U, 2286479452U, 540989846U, 2924655214U}, // permissiveLearningMode
+    {1006130002U, 2476145911U, 936156562U, 2453790590U, 874145428U, 3260978392U, 1523843091U, 690536145U}, // personalizationDeviceSettings
+    {383293015U, 3350740429U, 1839969850U, 1819881064U, 1569454686U, 4198502490U, 78857879U, 1413643331U}, // phoneCall
+    {951693731U, 901288528U, 2895271546U, 317143909U, 1504712250U, 25973806U, 3907851571U, 1618863794U}, // phoneCallHistory
+    {1631604711U, 3604716289U, 3767720303U, 698625756U, 2814662190U, 970047950U, 2326260488U, 1280393717U}, // phoneCallHistoryPublic
+    {2442212369U, 1516598453U, 2330995131U, 3469896071U, 605735848U, 2536580394U, 3691267241U, 2105387825U}, // phoneCallHistorySystem
+    {2035927579U, 283314533U, 3422103930U, 3587774809U, 765962649U, 3034203285U, 3544878962U, 607181067U}, // phoneCallSystem
+    {4064895015U, 342919570U, 1527821018U, 1398865317U, 2844761021U, 1295569757U, 2893040671U, 2720116481U}, // phoneLineTransportManagement
+    {1406971207U, 126784377U, 3203782471U, 3962216065U, 3911221394U, 2948374907U, 2464319569U, 1634326943U}, // picturesLibrary
+    {1849711939U, 2055372412U, 1430709549U, 403095800U, 2349372689U, 2887650183U, 34019435U, 3605578527U}, // pointOfService
+    {1341596463U, 1842471492U, 803414513U, 1600199594U, 325357669U, 2429983699U, 1407737418U, 1885917941U}, // powerDeviceSettings
+    {445163804U, 4260834626U, 64022583U, 2890516451U, 3185296510U, 2128918719U, 1210314806U, 274821335U}, // preemptiveCamera
+    {26449188U, 319411058U, 3949409539U, 1705362049U, 1925139826U, 1674502854U, 27253669U, 814862659U}, // previewHfx
+    {461248178U, 238806672U, 481084236U, 3891410989U, 2771223391U, 2696077494U, 4217549958U, 1571088004U}, // previewInkWorkspace
+    {1316175169U, 1773014438U, 1613326986U, 24619653U, 3648585828U, 3852118800U, 56534641U, 2026697600U}, // previewPenWorkspace
+    {3995113440U, 3884054055U, 1031826285U, 344537609U, 2951767964U, 1612438789U, 3955710486U, 685105120U}, // previewStore
+    {4039605918U, 3873411318U, 27610139U, 1128268345U, 19234073U, 2909949027U, 3062533374U, 2176626134U}, // previewUiComposition
+    {3451683122U, 3669176405U, 2623206703U, 410298525U, 609685457U, 245256422U, 1312352757U, 4006057415U}, // privateNetworkClientServer
+    {873788335U, 2211572166U, 2255199562U, 3772046584U, 2422496701U, 771418519U, 1902201794U, 2292330015U}, // projectionDeviceSettings
+    {3201220807U, 3619763700U, 1592940189U, 1757660495U, 672602728U, 3988728386U, 3927502142U, 3543502805U}, // protectedApp
+    {2277154106U, 1198253741U, 1251649293U, 2785554404U, 1571676292U, 3400936580U, 1687833907U, 3924095924U}, // proximity
+    {3819248598U, 2325341108U, 263814137U, 3273722481U, 4086152792U, 1551417442U, 514296332U, 2020513533U}, // radios
+    {1197439550U, 2076375017U, 2388317006U, 4244034133U, 3805565224U, 2676722506U, 3094586543U, 1803227934U}, // recordedCallsFolder
+    {3976976307U, 2806419199U, 3926481396U, 508527851U, 3236028540U, 826713606U, 280954376U, 4158454271U}, // regionSettings
+    {1065365936U, 1281604716U, 3511738428U, 1654721687U, 432734479U, 3232135806U, 4053264122U, 3456934681U}, // registryRead
+    {1447375928U, 2255811402U, 3714708160U, 2966800328U, 1666362609U, 2694121934U, 4074565427U, 2442860904U}, // relatedPackages
+    {1439478919U, 990579493U, 3627320768U, 2665985634U, 2354262676U, 2096604540U, 223614242U, 3656862712U}, // remoteFileAccess
+    {3897381677U, 2518389896U, 958950170U, 4086390243U, 3353327115U, 2219161105U, 2047156235U, 314897931U}, // remotePassportAuthentication
+    {3382307235U, 172505126U, 3436709648U, 3853344092U, 1878498961U, 3808853949U, 3782709338U, 3842044973U}, // remoteSystem
+    {1727008254U, 3289416835U, 1480208692U, 481164861U, 734055790U, 346467174U, 210577168U, 3440148169U}, // removableStorage
+    {1223709465U, 298379339U, 2017635312U, 1772383802U, 1712600024U, 1144051261U, 1141136244U, 3843461989U}, // resetPhone
+    {1365790099U, 2797813016U, 1714917928U, 519942599U, 2377126242U, 1094757716U, 3949770552U, 3596009590U}, // runFullTrust
+    {2752188826U, 3550772256U, 221158601U, 1503784687U, 2973994425U, 58216879U, 891029702U, 2423973439U}, // screenDuplication
+    {1086922356U, 207614091U, 3724853071U, 841836187U, 4018695103U, 34218837U, 3164163255U, 155871754U}, // searchSettings
+    {759497869U, 3426324426U, 2080302537U, 280970568U, 1023192118U, 597262764U, 3695343976U, 1004345243U}, // secondaryAuthenticationFactor
+    {1231405757U, 631568165U, 502048027U, 2646382484U, 613260345U, 2075369228U, 3000949285U, 4219498872U}, // secureAssessment
+    {464504522U, 3613564238U, 1750590852U, 1017417883U, 1861133207U, 1479667529U, 3846921728U, 1947332426U}, // sensors.custom
+    {2259232173U, 3065707605U, 3546759525U, 3107910369U, 1496933107U, 2416423869U, 535863999U, 1547775798U}, // serialCommunication
+    {3595123447U, 4143809960U, 2192099248U, 2222090582U, 3956830546U, 1413326885U, 1118183480U, 1300124416U}, // sessionImpersonation
+    {4013343662U, 1780721540U, 2368661007U, 3594614809U, 3500637591U, 3061816900U, 1306469177U, 829351717U}, // settingSyncConfiguration
+    {3407458705U, 1648901477U, 3477437477U, 2446469098U, 609902970U, 3968512836U, 1044670771U, 215142459U}, // sharedMachineKeysCapability
+    {2054765966U, 1632741161U, 2974110423U, 2018311271U, 2881354204U, 304237130U, 464421340U, 1092510287U}, // sharedUserCertificates
+    {2305152057U, 3071518883U, 3537672427U, 2214617062U, 2553570816U, 4170319841U, 830201352U, 3965352074U}, // shellDisplayManagement
+    {3167453650U, 624722384U, 889205278U, 321484983U, 714554697U, 3592933102U, 807660695U, 1632717421U}, // shellExperience
+    {2152139330U, 3124897132U, 671935159U, 3762809077U, 3273429135U, 2233686478U, 1435376800U, 2420532691U}, // shellExperienceComposer
+    {3578703928U, 3742718786U, 7859573U, 1930844942U, 2949799617U, 2910175080U, 1780299064U, 4145191454U}, // slapiQueryLicenseValue
+    {1882001508U, 3166212979U, 1759549478U, 1197938037U, 69236898U, 20095667U, 1131865092U, 67241044U}, // smbios
+    {3602025330U, 472807899U, 1205063840U, 3442271783U, 2274535149U, 813395580U, 170517792U, 1323823688U}, // sms
+    {128185722U, 850430189U, 1529384825U, 139260854U, 329499951U, 1660931883U, 3499805589U, 3019957964U}, // smsSend
+    {3480444203U, 4235629365U, 4094828944U, 2013630719U, 3891574212U, 838386981U, 1711373286U, 2543796314U}, // smsSystem
+    {3362896107U, 847302450U, 369767657U, 4208464410U, 123719904U, 3972218006U, 2749300081U, 169903797U}, // smsTransportSystem
+    {2254392608U, 3275252242U, 2040178665U, 1987576641U, 1815903846U, 2941108822U, 3851549638U, 2340068026U}, // spatialPerception
+    {782401966U, 1532617391U, 3031078076U, 101244278U, 3991565062U, 447768907U, 4209600932U, 4293427563U}, // startScreenManagement
+    {4267310653U, 3012624349U, 32869343U, 335676702U, 674013981U, 1531007892U, 2777328540U, 762217067U}, // storeAppInstall
+    {2558976728U, 3115931106U, 1512009022U, 3208506203U, 2008579624U, 341828572U, 3950653509U, 2339491937U}, // storeAppInstallation
+    {2707581722U, 3970398075U, 3301609242U, 3412871183U, 2565310287U, 2959982868U, 2531230773U, 2372594412U}, // storeConfiguration
+    {2819154332U, 3691255550U, 2499738133U, 2646149002U, 4290075130U, 3069449926U, 721213713U, 3168903538U}, // storeLicenseManagement
+    {3233358573U, 3222412776U, 4149189431U, 1049145218U, 2500383674U, 4050096179U, 2277312776U, 364530348U}, // storeOptionalPackageInstallManagement
+    {3430811103U, 1394355416U, 2761699064U, 1385698600U, 16500618U, 1940864512U, 2827186997U, 3488085323U}, // systemDialog
+    {3424959352U, 1973429139U, 2846531642U, 2399309467U, 3258902908U, 3185142175U, 1698087495U, 3907814294U}, // systemDialogEmergency
+    {1023893147U, 235863880U, 425656572U, 4266519675U, 2590647553U, 3475379062U, 430000033U, 3360374247U}, // systemManagement
+    {1118810203U, 3584274876U, 1313799976U, 736524742U, 894047348U, 2754362701U, 194785068U, 153062919U}, // systemRegistrar
+    {3036464858U, 3155602757U, 2052184566U, 2810840899U, 4148930525U, 1208855857U, 3369979990U, 1199230028U}, // targetedContent
+    {2720074253U, 2593895878U, 1367899712U, 1504396584U, 3115882398U, 2003648316U, 1959593896U, 1615940296U}, // targetedContentSubscription
+    {837347585U, 1999177933U, 4138097223U, 648202317U, 3984072298U, 3984207991U, 3571983512U, 2471634736U}, // teamEditionDeviceCredential
+    {2380060612U, 1737381507U, 4167045332U, 4184987838U, 4083872623U, 3212612518U, 450314405U, 3897841498U}, // teamEditionExperience
+    {3891729582U, 2544466909U, 2712269814U, 1176081771U, 3640883188U, 3155755306U, 1116579485U, 2332894950U}, // teamEditionView
+    {3373724040U, 1170344134U, 777822384U, 2786649692U, 2407439134U, 680197326U, 2745814539U, 2575387933U}, // telemetryData
+    {4109863507U, 315816024U, 705126643U, 4107540304U, 1229951577U, 3907543981U, 3063171489U, 2612387512U}, // terminalPowerManagement
+    {4261706848U, 3994739U, 668717478U, 463624320U, 2717824891U, 581166392U, 3604856260U, 471283224U}, // thumbnailCache
+    {3041133721U, 1480096532U, 832829000U, 2759367675U, 4090792977U, 1568020035U, 4217102551U, 1177475503U}, // timezone
+    {409472177U, 2062020225U, 525776845U, 2804668398U, 2154477689U, 2219989410U, 1065520914U, 4001898222U}, // uiAccess
+    {1762459923U, 1799621485U, 809105362U, 2834798648U, 1117523120U, 1672840655U, 346792126U, 3119424345U}, // uiAutomationSystem
+    {3844498485U, 4280973353U, 1424685246U, 2583229392U, 3035484506U, 1199963603U, 2231282027U, 2249995489U}, // unvirtualizedResources
+    {3119071125U, 1669795191U, 3411544654U, 3884382078U, 2434967118U, 699366913U, 3568888676U, 1151483144U}, // unzipFile
+    {2642055764U, 1853522529U, 3601982987U, 418283269U, 2220187745U, 2827089145U, 2403472374U, 2016924062U}, // updateAndSecurityDeviceSettings
+    {2220380775U, 2622013822U, 1599222386U, 2219895693U, 4014100651U, 1227276184U, 635187290U, 3404514634U}, // usb
+    {3014353654U, 4060050185U, 4188274494U, 1467411622U, 2017116772U, 860365275U, 2455311434U, 3523940624U}, // userAccountInformation
+    {70329670U, 3585251103U, 1149629936U, 3204666536U, 4257240719U, 2613976102U, 450591375U, 1666047922U}, // userDataAccountSetup
+    {624372219U, 572103895U, 3839054141U, 4184514356U, 2205606268U, 3026111568U, 3738370332U, 3748229556U}, // userDataAccountsProvider
+    {3324773698U, 3647103388U, 1207114580U, 2173246572U, 4287945184U, 2279574858U, 157813651U, 603457015U}, // userDataSystem
+    {1767905719U, 3826487505U, 162337170U, 292226844U, 3377689209U, 415238060U, 731096137U, 2045567052U}, // userDataTasks
+    {2697775780U, 1542377669U, 1066453660U, 3527412830U, 3006687094U, 2339763200U, 1478134599U, 2680133682U}, // userDataTasksSystem
+    {3935871839U, 531328186U, 2364288650U, 1952049222U, 2005882575U, 3855556509U, 3315028587U, 95077501U}, // userManagementSystem
+    {1195710214U, 366596411U, 2746218756U, 3015581611U, 3786706469U, 3006247016U, 1014575659U, 1338484819U}, // userNotificationListener
+    {2911463036U, 237878888U, 509312955U, 1981876715U, 2004097936U, 1552120448U, 2430620302U, 2295502469U}, // userPrincipalName
+    {1730716382U, 2949791265U, 2036182297U, 688374192U, 553408039U, 4133924312U, 4201181712U, 267922143U}, // userSigninSupport
+    {3755676145U, 4259313647U, 2808356580U, 3373894405U, 2165299177U, 498323172U, 48808592U, 1417246423U}, // userSystemId
+    {3251049817U, 2009456500U, 1551197491U, 2134558218U, 3545351942U, 817362876U, 3494650202U, 599247412U}, // userWebAccounts
+    {3951209665U, 2909853094U, 1704132547U, 2470142594U, 2985570362U, 3729008898U, 3515249751U, 304697738U}, // videosLibrary
+    {3299255270U, 1847605585U, 2201808924U, 710406709U, 3613095291U, 873286183U, 3101090833U, 2655911836U}, // visualElementsSystem
+    {725803317U, 1887434487U, 3794882127U, 3801973704U, 242823434U, 3911787684U, 1468823602U, 3559133575U}, // visualVoiceMail
+    {2268835264U, 3721307629U, 241982045U, 173645152U, 1490879176U, 104643441U, 2915960892U, 1612460704U}, // vmWorkerProcess
+    {528040493U, 3731447870U, 67007039U, 3324466937U, 472126288U, 3192664210U, 2621923198U, 3039294295U}, // voipCall
+    {3220540237U, 2689165624U, 4063022621U, 485423413U, 3446573505U, 530027026U, 3263391230U, 3512805223U}, // walletSystem
+    {806118685U, 1407903895U, 2682038770U, 2296481007U, 2544426249U, 1287025116U, 2346593712U, 219042290U}, // webPlatformMediaExtension
+    {4131216513U, 4266103714U, 3944869821U, 2853506808U, 3373049249U, 4035912394U, 2659877950U, 3593780078U}, // webcam
+    {1435741670U, 739137367U, 1743980217U, 3651543328U, 1944853929U, 2879019864U, 2752253861U, 3176136090U}, // wiFiControl
+    {2630151271U, 538039947U, 3438384650U, 3036271083U, 2444732472U, 3552936254U, 3601025621U, 3070579071U}, // wiFiDirect
+    {982116356U, 1157887588U, 2052581112U, 4048931602U, 275598005U, 2450320559U, 1358259137U, 3354152412U}, // wifiData
+    {3784963939U, 525976052U, 1984711482U, 555102806U, 2547956227U, 867522058U, 1103054514U, 4144925092U}, // windowManagement
+    {1911837662U, 2060215111U, 1926601727U, 951193427U, 565808881U, 1747239484U, 3173052995U, 3854891390U}, // windowManagementSystem
+    {1902118268U, 936929782U, 3474333872U, 803346623U, 1872623265U, 3899080591U, 2872335817U, 3963487957U}, // windowsHelloCredentialAccess
+    {1221526253U, 3924910130U, 1751405008U, 69508222U, 1499930412U, 38408379U, 3528704847U, 309525946U}, // windowsPerformanceCounters
+    {316617620U, 767886417U, 2031403316U, 4137648062U, 386588034U, 2282218452U, 745559578U, 2387228587U}, // xboxAccessoryManagement
+    {1456666081U, 3640717758U, 443640589U, 929037496U, 1153660644U, 3477228869U, 343279110U, 3437769230U}, // xboxBroadcaster
+    {1913821931U, 1108981997U, 895954514U, 4209058812U, 2801866697U, 2689726501U, 1421786583U, 1766464325U}, // xboxGameSpeechWindow
+    {1960811123U, 3677868401U, 325669015U, 1068014216U, 3567935757U, 2531561414U, 87310777U, 1481187038U}, // xboxLiveAuthenticationProvider
+    {2396548673U, 3660548412U, 478690371U, 1102408774U, 3574420896U, 3187205843U, 2937764204U, 870294981U}, // xboxSystemApplicationClipQuery
+    {609147554U, 2685133493U, 3856309926U, 531891704U, 4088700923U, 1956945467U, 291440665U, 298026926U}, // xboxTrackingStream
+};
+} // namespace priv
+
+#endif
@@ -1,11 +1,12 @@
 //
 #include "exec.hpp"
+#include "capabilitysid.hpp"
+#include "profilecache.hpp"
+#include "appxmanifest.hpp"
 #include <bela/base.hpp>
 #include <bela/codecvt.hpp>
 #include <bela/escapeargv.hpp>
-//#include <bela/phmap.hpp>
-#define PUGIXML_HEADER_ONLY 1
-#include <pugixml.hpp>
+#include <bela/io.hpp>
 #include <sddl.h>
 #include <Userenv.h>
 #include <accctrl.h>
@@ -27,59 +28,19 @@ template <typename T> struct Entry {
 };
 
 bool LoadAppx(std::wstring_view file, std::vector<std::wstring> &caps, bela::error_code &ec) {
-  pugi::xml_document doc;
-  if (!doc.load_file(file.data())) {
-    ec = bela::make_system_error_code(L"xml_document load ");
+  std::string content;
+  if (!bela::io::ReadFile(file, content, ec)) {
     return false;
   }
-  auto addCapability = [&](std::wstring &&sv) {
-    for (const auto &s : caps) {
-      if (bela::EqualsIgnoreCase(sv, s)) {
-        return;
-      }
-    }
-    caps.emplace_back(std::move(sv));
-  };
-  // Capability
-  // rescap:Capability
-  // uap:Capability
-  // uap3:Capability
-  // uap6:Capability
-  // wincap:Capability
-  // DeviceCapability
-  for (auto it : doc.child("Package").child("Capabilities")) {
-    addCapability(bela::ToWide(it.attribute("Name").as_string()));
+  // Capability, rescap:Capability, uap:Capability, uap3:Capability, uap6:Capability, wincap:Capability and
+  // DeviceCapability all live under Package/Capabilities
+  if (std::wstring error; !ParseAppxCapabilities(content, caps, error)) {
+    ec = bela::make_error_code(bela::ErrGeneral, error);
+    return false;
   }
   return true;
 }
 
-class SidArray {
-public:
-  SidArray() : count_(0), sids_(nullptr) {}
-
-  ~SidArray() {
-    if (sids_) {
-      for (size_t index = 0; index < count_; ++index) {
-        ::LocalFree(sids_[index]);
-      }
-      ::LocalFree(sids_);
-    }
-  }
-
-  DWORD count() { return count_; }
-  PSID *sids() { return sids_; }
-  PDWORD count_ptr() { return &count_; }
-  PSID **sids_ptr() { return &sids_; }
-
-private:
-  DWORD count_;
-  PSID *sids_;
-};
-
-typedef BOOL(WINAPI *DeriveCapabilitySidsFromNameImpl)(LPCWSTR CapName, PSID **CapabilityGroupSids,
-                                                       DWORD *CapabilityGroupSidCount, PSID **CapabilitySids,
-                                                       DWORD *CapabilitySidCount);
-
 bool appcommand::initialize(bela::error_code &ec) {
   if (!appmanifest.empty()) {
     if (!LoadAppx(appmanifest, caps, ec)) {
@@ -89,29 +50,98 @@ bool appcommand::initialize(bela::error_code &ec) {
   return true;
 }
 
-bool MakeDeriveSID(PSID &appcontainersid, capabilities_t &cas, appcommand &cmd, bela::error_code &ec) {
-  auto _DeriveCapabilitySidsFromName = (DeriveCapabilitySidsFromNameImpl)GetProcAddress(
-      GetModuleHandle(L"KernelBase.dll"), "DeriveCapabilitySidsFromName");
-  if (_DeriveCapabilitySidsFromName == nullptr) {
-    ec = bela::make_system_error_code(L"MakeDeriveSID<DeriveCapabilitySidsFromName> ");
-    return false;
+// RegistryProfileStore records the capability fingerprint of each profile under HKCU\Software\Privexec\AppContainer,
+// a profile counts as present while its mapping key exists
+class RegistryProfileStore : public ProfileStore {
+public:
+  static constexpr std::wstring_view fingerprintKey = L"Software\\Privexec\\AppContainer";
+  static constexpr std::wstring_view mappingsKey =
+      L"Software\\Classes\\Local Settings\\Software\\Microsoft\\Windows\\CurrentVersion\\AppContainer\\Mappings\\";
+  bool Lookup(std::wstring_view appid, const SidBuffer &sid, std::wstring &fingerprint) override {
+    auto mapping = bela::StringCat(mappingsKey, sid.String());
+    HKEY hkey = nullptr;
+    if (RegOpenKeyExW(HKEY_CURRENT_USER, mapping.data(), 0, KEY_READ, &hkey) != ERROR_SUCCESS) {
+      return false;
+    }
+    RegCloseKey(hkey);
+    std::wstring name(appid);
+    wchar_t buffer[128];
+    DWORD cb = sizeof(buffer);
+    if (RegGetValueW(HKEY_CURRENT_USER, fingerprintKey.data(), name.data(), RRF_RT_REG_SZ, nullptr, buffer, &cb) !=
+        ERROR_SUCCESS) {
+      return false;
+    }
+    fingerprint.assign(buffer);
+    return true;
   }
-  for (const auto &n : cmd.caps) {
-    DWORD dwn = 0, dwca = 0;
-    SidArray capability_group_sids;
-    SidArray capability_sids;
-    if (!_DeriveCapabilitySidsFromName(n.c_str(), capability_group_sids.sids_ptr(), capability_group_sids.count_ptr(),
-                                       capability_sids.sids_ptr(), capability_sids.count_ptr())) {
-      continue;
+  bool Recreate(std::wstring_view appid, std::span<const sid_bytes_t> capabilities) override {
+    std::wstring name(appid);
+    std::vector<SID_AND_ATTRIBUTES> cas;
+    cas.reserve(capabilities.size());
+    for (const auto &c : capabilities) {
+      cas.push_back(SID_AND_ATTRIBUTES{const_cast<uint8_t *>(c.data()), SE_GROUP_ENABLED});
     }
-    if (capability_sids.count() < 1) {
-      continue;
+    DeleteAppContainerProfile(name.data()); // ignore error
+    PSID appcontainersid = nullptr;
+    if (CreateAppContainerProfile(name.data(), name.data(), name.data(), (cas.empty() ? NULL : cas.data()),
+                                  (DWORD)cas.size(), &appcontainersid) != S_OK) {
+      ec = bela::make_system_error_code(L"CreateAppContainerProfile ");
+      return false;
     }
-    auto csid = HeapAlloc(GetProcessHeap(), 0, SECURITY_MAX_SID_SIZE);
+    // the caller already holds the derived SID
+    FreeSid(appcontainersid);
+    return true;
+  }
+  bool Record(std::wstring_view appid, std::wstring_view fingerprint) override {
+    std::wstring name(appid);
+    return RegSetKeyValueW(HKEY_CURRENT_USER, fingerprintKey.data(), name.data(), REG_SZ, fingerprint.data(),
+                           static_cast<DWORD>((fingerprint.size() + 1) * sizeof(wchar_t))) == ERROR_SUCCESS;
+  }
+  bela::error_code ec;
+};
+
+// AcquireProfile reuses the profile named appid when it was created with the same capabilities, appcontainersid is
+// released with FreeSid like the one CreateAppContainerProfile returns
+bool AcquireProfile(PSID &appcontainersid, const capabilities_t &cas, std::wstring_view appid, bela::error_code &ec) {
+  std::vector<sid_bytes_t> capabilities;
+  capabilities.reserve(cas.size());
+  for (const auto &c : cas) {
+    capabilities.emplace_back(static_cast<const uint8_t *>(c.Sid), GetLengthSid(c.Sid));
+  }
+  RegistryProfileStore store;
+  ProfileCache cache(store);
+  SidBuffer sid;
+  auto status = cache.Acquire(appid, capabilities, sid);
+  if (status == profile_status::failed) {
+    ec = std::move(store.ec);
+    return false;
+  }
+  DWORD subauthorities[8] = {0};
+  auto count = (std::min)(sid.SubAuthorityCount(), std::size(subauthorities));
+  for (size_t i = 0; i < count; i++) {
+    subauthorities[i] = sid.SubAuthority(i);
+  }
+  SID_IDENTIFIER_AUTHORITY authority = SECURITY_APP_PACKAGE_AUTHORITY;
+  if (AllocateAndInitializeSid(&authority, static_cast<BYTE>(count), subauthorities[0], subauthorities[1],
+                               subauthorities[2], subauthorities[3], subauthorities[4], subauthorities[5],
+                               subauthorities[6], subauthorities[7], &appcontainersid) != TRUE) {
+    ec = bela::make_system_error_code(L"AcquireProfile<AllocateAndInitializeSid> ");
+    return false;
+  }
+  return true;
+}
+
+bool MakeDeriveSID(PSID &appcontainersid, capabilities_t &cas, appcommand &cmd, bela::error_code &ec) {
+  // capability SIDs are a hash of the name, no need to ask KernelBase for each one
+  std::vector<SidBuffer> sids;
+  DeriveCapabilitySids(cmd.caps, nullptr, &sids);
+  for (const auto &s : sids) {
+    auto csid = HeapAlloc(GetProcessHeap(), 0, s.size());
     if (csid == nullptr) {
+      ec = bela::make_system_error_code(L"MakeDeriveSID<HeapAlloc> ");
       return false;
     }
-    ::CopySid(SECURITY_MAX_SID_SIZE, csid, capability_sids.sids()[0]);
+    memcpy(csid, s.data(), s.size());
     SID_AND_ATTRIBUTES attr;
     attr.Sid = csid;
     attr.Attributes = SE_GROUP_ENABLED;
@@ -121,13 +151,7 @@ bool MakeDeriveSID(PSID &appcontainersid, capabilities_t &cas, appcommand &cmd,
   if (cmd.appid.empty()) {
     cmd.appid = appid;
   }
-  DeleteAppContainerProfile(cmd.appid.data()); // ignore error
-  if (CreateAppContainerProfile(cmd.appid.data(), cmd.appid.data(), cmd.appid.data(), (cas.empty() ? NULL : cas.data()),
-                                (DWORD)cas.size(), &appcontainersid) != S_OK) {
-    ec = bela::make_system_error_code(L"MakeDeriveSID<CreateAppContainerProfile> ");
-    return false;
-  }
-  return true;
+  return AcquireProfile(appcontainersid, cas, cmd.appid, ec);
 }
 
 bool MakeSID(PSID &appcontainersid, capabilities_t &cas, appcommand &cmd, bela::error_code &ec) {
@@ -170,13 +194,7 @@ bool MakeSID(PSID &appcontainersid, capabilities_t &cas, appcommand &cmd, bela::
   if (cmd.appid.empty()) {
     cmd.appid = appid;
   }
-  DeleteAppContainerProfile(cmd.appid.data()); // ignore error
-  if (CreateAppContainerProfile(cmd.appid.data(), cmd.appid.data(), cmd.appid.data(), (cas.empty() ? NULL : cas.data()),
-                                (DWORD)cas.size(), &appcontainersid) != S_OK) {
-    ec = bela::make_system_error_code(L"MakeSID<CreateAppContainerProfile> ");
-    return false;
-  }
-  return true;
+  return AcquireProfile(appcontainersid, cas, cmd.appid, ec);
 }
 
 bool AllowNameObjectAccess(PSID appContainerSid, LPWSTR name, SE_OBJECT_TYPE type, ACCESS_MASK accessMask) {
@@ -294,7 +312,7 @@ bool appcommand::execute(bela::error_code &ec) {
   for (const auto &a : argv) {
     ea.Append(a);
   }
-  if (CreateProcessW(string_nullable(path), ea.data(), nullptr, nullptr, FALSE, createflags, string_nullable(env),
+  if (CreateProcessW(string_nullable(path), ea.data(), nullptr, nullptr, FALSE, createflags, env_nullable(env),
                      string_nullable(cwd), reinterpret_cast<STARTUPINFOW *>(&siex), &pi) != TRUE) {
     ec = bela::make_system_error_code(L"appcommand::execute<CreateProcessW> ");
     return false;
@@ -0,0 +1,470 @@
+//
+#include <algorithm>
+#include <bit>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+#include "appxmanifest.hpp"
+
+namespace wsudo::exec {
+constexpr wchar_t asciiLower(wchar_t c) { return c >= L'A' && c <= L'Z' ? static_cast<wchar_t>(c + (L'a' - L'A')) : c; }
+
+struct capabilityHash {
+  size_t operator()(std::wstring_view s) const noexcept {
+    size_t h = 14695981039346656037ULL;
+    for (auto c : s) {
+      h ^= static_cast<size_t>(asciiLower(c));
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+};
+
+struct capabilityEq {
+  bool operator()(std::wstring_view a, std::wstring_view b) const noexcept {
+    if (a.size() != b.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+      if (asciiLower(a[i]) != asciiLower(b[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+inline void appendCodePoint(std::wstring &out, char32_t cp) {
+  if constexpr (sizeof(wchar_t) == 2) {
+    if (cp > 0xFFFF) {
+      cp -= 0x10000;
+      out.push_back(static_cast<wchar_t>(0xD800 + (cp >> 10)));
+      out.push_back(static_cast<wchar_t>(0xDC00 + (cp & 0x3FF)));
+      return;
+    }
+  }
+  out.push_back(static_cast<wchar_t>(cp));
+}
+
+// appendText decodes one attribute value, UTF-8 or UTF-16 code units plus the XML character references
+template <typename C> void appendText(std::wstring &out, std::basic_string_view<C> v) {
+  out.reserve(out.size() + v.size());
+  for (size_t i = 0; i < v.size();) {
+    // runs of ASCII without references, most names are one, are widened in a single loop
+    auto run = i;
+    while (run < v.size() && static_cast<std::make_unsigned_t<C>>(v[run]) < 0x80 && v[run] != C('&')) {
+      run++;
+    }
+    if (run != i) {
+      auto n = out.size();
+      out.resize(n + run - i);
+      for (auto k = i; k < run; k++) {
+        out[n + k - i] = static_cast<wchar_t>(v[k]);
+      }
+      i = run;
+      continue;
+    }
+    auto c = static_cast<char32_t>(static_cast<std::make_unsigned_t<C>>(v[i]));
+    if (c == '&') {
+      auto end = v.find(C(';'), i);
+      if (end != std::basic_string_view<C>::npos) {
+        auto ref = v.substr(i + 1, end - i - 1);
+        auto is = [&](std::string_view s) {
+          return ref.size() == s.size() && std::equal(s.begin(), s.end(), ref.begin());
+        };
+        char32_t r = 0;
+        if (is("lt")) {
+          r = '<';
+        } else if (is("gt")) {
+          r = '>';
+        } else if (is("amp")) {
+          r = '&';
+        } else if (is("quot")) {
+          r = '"';
+        } else if (is("apos")) {
+          r = '\'';
+        } else if (ref.size() > 1 && ref[0] == C('#')) {
+          bool hex = ref[1] == C('x');
+          for (size_t k = hex ? 2 : 1; k < ref.size(); k++) {
+            auto d = static_cast<char32_t>(ref[k]);
+            if (d >= '0' && d <= '9') {
+              r = r * (hex ? 16 : 10) + (d - '0');
+            } else if (hex && (d | 0x20) >= 'a' && (d | 0x20) <= 'f') {
+              r = r * 16 + ((d | 0x20) - 'a' + 10);
+            } else {
+              r = 0;
+              break;
+            }
+            // stopping past the last code point keeps r from overflowing on long digit runs
+            if (r > 0x10FFFF) {
+              r = 0;
+              break;
+            }
+          }
+          if (r >= 0xD800 && r <= 0xDFFF) {
+            r = 0;
+          }
+        }
+        if (r != 0) {
+          appendCodePoint(out, r);
+          i = end + 1;
+          continue;
+        }
+      }
+    }
+    if constexpr (sizeof(C) == 1) {
+      // UTF-8, malformed sequences become U+FFFD: bad lead or continuation bytes, overlong forms, surrogates and code
+      // points past U+10FFFF
+      constexpr char32_t minimum[] = {0, 0, 0x80, 0x800, 0x10000};
+      size_t len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 0;
+      bool valid = len != 0 && i + len <= v.size();
+      if (valid && len > 1) {
+        c &= (0x7F >> len);
+        for (size_t k = 1; k < len && valid; k++) {
+          auto b = static_cast<unsigned char>(v[i + k]);
+          valid = (b & 0xC0) == 0x80;
+          c = (c << 6) | (b & 0x3F);
+        }
+        valid = valid && c >= minimum[len] && c <= 0x10FFFF && (c < 0xD800 || c > 0xDFFF);
+      }
+      if (!valid) {
+        appendCodePoint(out, 0xFFFD);
+        i++;
+        continue;
+      }
+      appendCodePoint(out, c);
+      i += len;
+      continue;
+    }
+    // UTF-16 code units are copied as they are, pairs included
+    if constexpr (sizeof(wchar_t) == 2) {
+      out.push_back(static_cast<wchar_t>(c));
+      i++;
+    } else {
+      if (c >= 0xD800 && c <= 0xDBFF && i + 1 < v.size()) {
+        auto lo = static_cast<char32_t>(v[i + 1]);
+        if (lo >= 0xDC00 && lo <= 0xDFFF) {
+          appendCodePoint(out, 0x10000 + ((c - 0xD800) << 10) + (lo - 0xDC00));
+          i += 2;
+          continue;
+        }
+      }
+      out.push_back(static_cast<wchar_t>(c));
+      i++;
+    }
+  }
+}
+
+// capabilityList holds decoded names back to back in one buffer, two allocations however many capabilities there are
+class capabilityList {
+public:
+  size_t size() const { return ends.size(); }
+  std::wstring_view operator[](size_t i) const {
+    auto begin = i == 0 ? 0 : ends[i - 1];
+    return std::wstring_view(text).substr(begin, ends[i] - begin);
+  }
+  template <typename C> void Append(std::basic_string_view<C> v) {
+    auto begin = text.size();
+    appendText(text, v);
+    if (text.size() != begin) {
+      ends.emplace_back(text.size());
+    }
+  }
+
+private:
+  std::wstring text;
+  std::vector<size_t> ends;
+};
+
+// manifestScanner walks start and end tags only, tracking how deep the open elements match Package/Capabilities
+template <typename C> class manifestScanner {
+public:
+  using view_type = std::basic_string_view<C>;
+  explicit manifestScanner(view_type s_) : s(s_) {}
+  bool Scan(capabilityList &names, std::wstring &error);
+
+private:
+  view_type s;
+  size_t pos{0};
+  static bool equals(view_type a, std::string_view b) {
+    return a.size() == b.size() && std::equal(b.begin(), b.end(), a.begin());
+  }
+  static bool isSpace(C c) { return c == C(' ') || c == C('\t') || c == C('\r') || c == C('\n'); }
+  bool startsWith(std::string_view p) const { return equals(s.substr(pos, p.size()), p); }
+  // skipPast moves pos behind the next terminator, false when the input ends first
+  bool skipPast(std::string_view terminator) {
+    for (auto i = pos;; i++) {
+      i = find(static_cast<C>(terminator.front()), i);
+      if (i == view_type::npos || i + terminator.size() > s.size()) {
+        return false;
+      }
+      if (equals(s.substr(i, terminator.size()), terminator)) {
+        pos = i + terminator.size();
+        return true;
+      }
+    }
+  }
+  bool closeTag(size_t i, bool &selfClosing) {
+    selfClosing = i > pos && s[i - 1] == C('/');
+    pos = i + 1;
+    return true;
+  }
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  static constexpr size_t lanes = sizeof(__m128i) / sizeof(C);
+  // matches sets bit k when code unit i + k is c
+  uint32_t matches(size_t i, C c) const {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s.data() + i));
+    if constexpr (sizeof(C) == 1) {
+      return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(c)))));
+    } else {
+      auto eq = _mm_cmpeq_epi16(v, _mm_set1_epi16(static_cast<short>(c)));
+      return static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(eq, eq))) & 0xFF;
+    }
+  }
+#endif
+  // find is view_type::find inlined, the gaps between tags and the end tags are too short to be worth a memchr call
+  size_t find(C c, size_t i) const {
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    for (; i + lanes <= s.size(); i += lanes) {
+      if (auto m = matches(i, c); m != 0) {
+        return i + std::countr_zero(m);
+      }
+    }
+#endif
+    for (; i < s.size(); i++) {
+      if (s[i] == c) {
+        return i;
+      }
+    }
+    return view_type::npos;
+  }
+  // skipTag moves pos behind the '>' closing a start tag, quoted attribute values may hold '>'. With SSE2 a block of
+  // code units is looked at once: the running parity of '"' marks the quoted ones and the first '>' outside them ends
+  // the tag. A block holding '\'' is left to the scalar loop.
+  bool skipTag(bool &selfClosing) {
+    auto i = pos;
+    C quote = 0;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    uint32_t quoted = 0;
+    for (; i + lanes <= s.size(); i += lanes) {
+      if (matches(i, C('\'')) != 0) {
+        break;
+      }
+      auto inside = matches(i, C('"'));
+      inside ^= inside << 1;
+      inside ^= inside << 2;
+      inside ^= inside << 4;
+      inside ^= inside << 8;
+      inside ^= quoted;
+      if (auto close = matches(i, C('>')) & ~inside; close != 0) {
+        return closeTag(i + std::countr_zero(close), selfClosing);
+      }
+      quoted = (inside >> (lanes - 1) & 1) != 0 ? ~0U : 0;
+    }
+    quote = quoted != 0 ? C('"') : 0;
+#endif
+    for (; i < s.size(); i++) {
+      auto c = s[i];
+      if (quote != 0) {
+        quote = c == quote ? 0 : quote;
+        continue;
+      }
+      if (c == C('"') || c == C('\'')) {
+        quote = c;
+        continue;
+      }
+      if (c == C('>')) {
+        return closeTag(i, selfClosing);
+      }
+    }
+    return false;
+  }
+  bool parseAttributes(capabilityList &names, bool &selfClosing, std::wstring &error);
+};
+
+template <typename C>
+bool manifestScanner<C>::parseAttributes(capabilityList &names, bool &selfClosing, std::wstring &error) {
+  bool found = false;
+  for (;;) {
+    while (pos < s.size() && isSpace(s[pos])) {
+      pos++;
+    }
+    if (pos >= s.size()) {
+      error = L"appx: unterminated start tag";
+      return false;
+    }
+    if (s[pos] == C('>')) {
+      pos++;
+      return true;
+    }
+    if (s[pos] == C('/')) {
+      selfClosing = true;
+      pos++;
+      continue;
+    }
+    auto attrBegin = pos;
+    while (pos < s.size() && s[pos] != C('=') && !isSpace(s[pos]) && s[pos] != C('>')) {
+      pos++;
+    }
+    auto attr = s.substr(attrBegin, pos - attrBegin);
+    while (pos < s.size() && isSpace(s[pos])) {
+      pos++;
+    }
+    if (pos >= s.size() || s[pos] != C('=')) {
+      error = L"appx: malformed attribute";
+      return false;
+    }
+    pos++;
+    while (pos < s.size() && isSpace(s[pos])) {
+      pos++;
+    }
+    if (pos >= s.size() || (s[pos] != C('"') && s[pos] != C('\''))) {
+      error = L"appx: malformed attribute";
+      return false;
+    }
+    auto quote = s[pos++];
+    auto end = s.find(quote, pos);
+    if (end == view_type::npos) {
+      error = L"appx: unterminated attribute value";
+      return false;
+    }
+    if (!found && equals(attr, "Name")) {
+      found = true;
+      names.Append(s.substr(pos, end - pos));
+    }
+    pos = end + 1;
+  }
+}
+
+template <typename C> bool manifestScanner<C>::Scan(capabilityList &names, std::wstring &error) {
+  constexpr std::string_view path[] = {"Package", "Capabilities"};
+  size_t depth = 0;
+  size_t matched = 0;
+  for (;;) {
+    pos = find(C('<'), pos);
+    if (pos == view_type::npos) {
+      if (depth != 0) {
+        error = L"appx: unexpected end of manifest";
+        return false;
+      }
+      return true;
+    }
+    auto next = pos + 1 < s.size() ? s[pos + 1] : C(0);
+    if (next == C('?') || next == C('!')) {
+      auto terminator = next == C('?') ? "?>" : startsWith("<!--") ? "-->" : startsWith("<![CDATA[") ? "]]>" : ">";
+      if (!skipPast(terminator)) {
+        error = L"appx: unterminated markup";
+        return false;
+      }
+      continue;
+    }
+    bool endTag = next == C('/');
+    pos += endTag ? 2 : 1;
+    if (endTag) {
+      if (depth == 0 || !skipPast(">")) {
+        error = L"appx: unbalanced end tag";
+        return false;
+      }
+      depth--;
+      if (depth == 0 || (depth == 1 && matched == 2)) {
+        // the root element or Capabilities closed, nothing of interest follows
+        return true;
+      }
+      matched = (std::min)(matched, depth);
+      continue;
+    }
+    // the name is only read where the path may go on and in front of the attributes of a child of Capabilities, the
+    // other start tags are skipped quote-aware from their '<'
+    bool along = depth == matched && matched < std::size(path);
+    bool child = depth == 2 && matched == 2;
+    view_type name;
+    if (along || child) {
+      auto nameBegin = pos;
+      while (pos < s.size() && !isSpace(s[pos]) && s[pos] != C('>') && s[pos] != C('/')) {
+        pos++;
+      }
+      name = s.substr(nameBegin, pos - nameBegin);
+    }
+    bool selfClosing = false;
+    if (child ? !parseAttributes(names, selfClosing, error) : !skipTag(selfClosing)) {
+      if (error.empty()) {
+        error = L"appx: unterminated start tag";
+      }
+      return false;
+    }
+    if (along && equals(name, path[matched])) {
+      if (selfClosing) {
+        // <Capabilities/> or <Package/>
+        return true;
+      }
+      matched++;
+    }
+    if (!selfClosing) {
+      depth++;
+    }
+  }
+}
+
+bool extractCapabilities(std::string_view content, capabilityList &names, std::wstring &error) {
+  auto bytes = reinterpret_cast<const unsigned char *>(content.data());
+  // UTF-16 is told by its byte order mark, or without one by the first '<' as XML 1.0 Appendix F guesses
+  auto b0 = content.size() >= 2 ? bytes[0] : 0xEF;
+  auto b1 = content.size() >= 2 ? bytes[1] : 0xEF;
+  if ((b0 == 0xFF && b1 == 0xFE) || (b0 == 0xFE && b1 == 0xFF) || (b0 == '<' && b1 == 0) || (b0 == 0 && b1 == '<')) {
+    // copied once into aligned code units in native order
+    auto skip = b0 == '<' || b1 == '<' ? 0 : 2;
+    auto lo = b0 == 0xFF || b0 == '<' ? 0 : 1;
+    std::u16string units((content.size() - skip) / 2, u'\0');
+    for (size_t i = 0; i < units.size(); i++) {
+      auto p = bytes + skip + i * 2;
+      units[i] = static_cast<char16_t>(p[lo] | p[1 - lo] << 8);
+    }
+    return manifestScanner<char16_t>(units).Scan(names, error);
+  }
+  if (content.size() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF) {
+    content.remove_prefix(3);
+  }
+  return manifestScanner<char>(content).Scan(names, error);
+}
+
+// mergeCapabilities deduplicates through an open addressing table of indexes into caps, one allocation per merge
+void mergeCapabilities(std::vector<std::wstring> &caps, const capabilityList &names) {
+  constexpr auto empty = static_cast<uint32_t>(-1);
+  size_t size = 16;
+  while (size < (caps.size() + names.size()) * 2) {
+    size <<= 1;
+  }
+  std::vector<uint32_t> slots(size, empty);
+  auto mask = size - 1;
+  // probe inserts index for v unless an equal name is present
+  auto probe = [&](std::wstring_view v, size_t index) {
+    for (auto i = capabilityHash{}(v) & mask;; i = (i + 1) & mask) {
+      if (slots[i] == empty) {
+        slots[i] = static_cast<uint32_t>(index);
+        return true;
+      }
+      if (capabilityEq{}(caps[slots[i]], v)) {
+        return false;
+      }
+    }
+  };
+  for (size_t i = 0; i < caps.size(); i++) {
+    probe(caps[i], i);
+  }
+  for (size_t i = 0; i < names.size(); i++) {
+    if (auto n = names[i]; probe(n, caps.size())) {
+      caps.emplace_back(n);
+    }
+  }
+}
+
+bool ParseAppxCapabilities(std::string_view content, std::vector<std::wstring> &caps, std::wstring &error) {
+  capabilityList names;
+  if (!extractCapabilities(content, names, error)) {
+    return false;
+  }
+  mergeCapabilities(caps, names);
+  return true;
+}
+
+} // namespace wsudo::exec
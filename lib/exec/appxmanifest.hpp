@@ -0,0 +1,15 @@
+// AppxManifest capability extraction
+#ifndef WSUDO_APPXMANIFEST_HPP
+#define WSUDO_APPXMANIFEST_HPP
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wsudo::exec {
+// ParseAppxCapabilities appends the Name of every child of Package/Capabilities in content, UTF-8 or UTF-16 in either
+// byte order with or without a byte order mark, to caps. Names already in caps are skipped, ignoring ASCII case. The
+// manifest is scanned as a stream without building a document and the scan stops once Capabilities closes.
+bool ParseAppxCapabilities(std::string_view content, std::vector<std::wstring> &caps, std::wstring &error);
+} // namespace wsudo::exec
+
+#endif
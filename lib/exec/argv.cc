@@ -5,16 +5,17 @@
 
 namespace wsudo::exec {
 //
-bool SplitArgv(std::wstring_view cmd, std::wstring &path, std::vector<std::wstring> &argv, bela::error_code &ec) {
+bool SplitArgv(std::wstring_view cmd, std::wstring &path, std::vector<std::wstring> &argv, bela::error_code &ec,
+               bela::env::ExecutableIndex *index) {
   bela::Tokenizer tokenizer;
   if (!tokenizer.Tokenize(cmd)) {
     ec = bela::make_error_code(1, L"bad command '", cmd, L"'");
     return false;
   }
-  const auto Argv = tokenizer.Argv();
-  const auto Argc = tokenizer.Argc();
-  for (size_t i = 0; i < Argc; i++) {
-    argv.emplace_back(Argv[i]);
+  const auto args = tokenizer.Args();
+  argv.reserve(argv.size() + args.size());
+  for (const auto a : args) {
+    argv.emplace_back(a);
   }
   if (argv.empty()) {
     ec = bela::make_error_code(1, L"bad command '", cmd, L"'");
@@ -22,7 +23,7 @@ bool SplitArgv(std::wstring_view cmd, std::wstring &path, std::vector<std::wstri
   }
   std::wstring_view arg0 = path.empty() ? argv[0] : path;
   std::wstring p;
-  if (!bela::env::LookPath(arg0, p, true)) {
+  if (!(index == nullptr ? bela::env::LookPath(arg0, p, true) : bela::env::LookPath(arg0, p, *index, true))) {
     ec = bela::make_error_code(1, L"command not found '", arg0, L"'");
     return false;
   }
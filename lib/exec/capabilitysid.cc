@@ -0,0 +1,132 @@
+//
+#include <bela/hash.hpp>
+#include <algorithm>
+#include <capabilityindex.hpp>
+#include <capabilitysids.hpp>
+#include "capabilitysid.hpp"
+
+namespace wsudo::exec {
+static_assert(std::size(priv::KnownCapabilityNames) == std::size(priv::KnownCapabilityRids),
+              "capabilitysids.hpp is out of date, regenerate it with capsid_test --table");
+
+constexpr uint8_t SecurityNtAuthority = 5;
+constexpr uint8_t SecurityAppPackageAuthority = 15;
+constexpr uint32_t SecurityBuiltinDomainRid = 32;
+constexpr uint32_t SecurityAppContainerBaseRid = 2;
+constexpr uint32_t SecurityCapabilityBaseRid = 3;
+constexpr uint32_t SecurityCapabilityAppRid = 1024;
+
+void SidBuffer::Assign(uint8_t authority, std::span<const uint32_t> subauthorities) {
+  auto count = (std::min)(subauthorities.size(), max_subauthorities);
+  buffer[0] = 1; // SID_REVISION
+  buffer[1] = static_cast<uint8_t>(count);
+  // IdentifierAuthority is six big-endian bytes
+  memset(buffer + 2, 0, 5);
+  buffer[7] = authority;
+  for (size_t i = 0; i < count; i++) {
+    auto p = buffer + 8 + i * 4;
+    auto rid = subauthorities[i];
+    p[0] = static_cast<uint8_t>(rid);
+    p[1] = static_cast<uint8_t>(rid >> 8);
+    p[2] = static_cast<uint8_t>(rid >> 16);
+    p[3] = static_cast<uint8_t>(rid >> 24);
+  }
+}
+
+std::wstring SidBuffer::String() const {
+  // plain std::to_wstring keeps this file free of Windows-only code, see test/capsid
+  auto s = L"S-" + std::to_wstring(buffer[0]) + L"-" + std::to_wstring(Authority());
+  for (size_t i = 0; i < SubAuthorityCount(); i++) {
+    s.append(L"-").append(std::to_wstring(SubAuthority(i)));
+  }
+  return s;
+}
+
+constexpr wchar_t asciiUpper(wchar_t c) { return c >= L'a' && c <= L'z' ? static_cast<wchar_t>(c - (L'a' - L'A')) : c; }
+
+constexpr wchar_t asciiLower(wchar_t c) { return c >= L'A' && c <= L'Z' ? static_cast<wchar_t>(c + (L'a' - L'A')) : c; }
+
+// hashName stores the first count little-endian DWORDs of SHA-256 over the UTF-16LE code units of name after fold.
+// Windows folds with RtlUpcaseUnicodeString or RtlDowncaseUnicodeString, for ASCII names the result is the same.
+template <typename Fold> void hashName(std::wstring_view name, Fold fold, uint32_t *rids, size_t count) {
+  bela::hash::sha256::Hasher h;
+  h.Initialize();
+  uint8_t buffer[256];
+  size_t n = 0;
+  auto put = [&](uint32_t cu) {
+    if (n == sizeof(buffer)) {
+      h.Update(buffer, n);
+      n = 0;
+    }
+    buffer[n++] = static_cast<uint8_t>(cu);
+    buffer[n++] = static_cast<uint8_t>(cu >> 8);
+  };
+  for (auto c : name) {
+    auto ch = static_cast<uint32_t>(fold(c));
+    if (ch > 0xFFFF) {
+      // 32-bit wchar_t, hash the UTF-16 surrogate pair Windows would see
+      ch -= 0x10000;
+      put(0xD800 + (ch >> 10));
+      put(0xDC00 + (ch & 0x3FF));
+      continue;
+    }
+    put(ch);
+  }
+  h.Update(buffer, n);
+  uint8_t sum[bela::hash::sha256::sha256_hash_size];
+  h.Finalize(sum, sizeof(sum));
+  for (size_t i = 0; i < count; i++) {
+    auto p = sum + i * 4;
+    rids[i] = static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 |
+              static_cast<uint32_t>(p[3]) << 24;
+  }
+}
+
+void HashCapabilityRids(std::wstring_view name, capability_rids_t &rids) {
+  hashName(name, asciiUpper, rids, capability_rids_size);
+}
+
+void DeriveCapabilityRids(std::wstring_view name, capability_rids_t &rids) {
+  if (auto index = priv::LookupCapabilityIndex(name); index >= 0) {
+    memcpy(rids, priv::KnownCapabilityRids[index], sizeof(rids));
+    return;
+  }
+  HashCapabilityRids(name, rids);
+}
+
+void DeriveCapabilitySids(std::wstring_view name, SidBuffer *group, SidBuffer *capability) {
+  capability_rids_t rids;
+  DeriveCapabilityRids(name, rids);
+  uint32_t subauthorities[SidBuffer::max_subauthorities];
+  memcpy(subauthorities + 2, rids, sizeof(rids));
+  if (group != nullptr) {
+    subauthorities[1] = SecurityBuiltinDomainRid;
+    group->Assign(SecurityNtAuthority, std::span{subauthorities + 1, capability_rids_size + 1});
+  }
+  if (capability != nullptr) {
+    subauthorities[0] = SecurityCapabilityBaseRid;
+    subauthorities[1] = SecurityCapabilityAppRid;
+    capability->Assign(SecurityAppPackageAuthority, std::span{subauthorities, capability_rids_size + 2});
+  }
+}
+
+void DeriveCapabilitySids(std::span<const std::wstring> names, std::vector<SidBuffer> *groups,
+                          std::vector<SidBuffer> *capabilities) {
+  if (groups != nullptr) {
+    groups->reserve(groups->size() + names.size());
+  }
+  if (capabilities != nullptr) {
+    capabilities->reserve(capabilities->size() + names.size());
+  }
+  for (const auto &n : names) {
+    DeriveCapabilitySids(n, groups == nullptr ? nullptr : &groups->emplace_back(),
+                         capabilities == nullptr ? nullptr : &capabilities->emplace_back());
+  }
+}
+void DeriveAppContainerSid(std::wstring_view appid, SidBuffer &sid) {
+  uint32_t subauthorities[appcontainer_rids_size + 1];
+  subauthorities[0] = SecurityAppContainerBaseRid;
+  hashName(appid, asciiLower, subauthorities + 1, appcontainer_rids_size);
+  sid.Assign(SecurityAppPackageAuthority, subauthorities);
+}
+} // namespace wsudo::exec
@@ -0,0 +1,53 @@
+// capability SID derivation without DeriveCapabilitySidsFromName
+#ifndef WSUDO_CAPABILITYSID_HPP
+#define WSUDO_CAPABILITYSID_HPP
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wsudo::exec {
+// A capability name hashes to 8 sub authorities: SHA-256 of the upper-cased UTF-16LE name, read as little-endian
+// DWORDs. The capability SID is S-1-15-3-1024-<rids>, the capability group SID is S-1-5-32-<rids>.
+constexpr size_t capability_rids_size = 8;
+using capability_rids_t = uint32_t[capability_rids_size];
+
+// SidBuffer is one binary SID laid out as the SID structure, data() can be used as a PSID
+class SidBuffer {
+public:
+  static constexpr size_t max_subauthorities = capability_rids_size + 2;
+  SidBuffer() = default;
+  [[nodiscard]] const void *data() const { return buffer; }
+  [[nodiscard]] void *data() { return buffer; }
+  [[nodiscard]] size_t size() const { return 8 + static_cast<size_t>(buffer[1]) * 4; }
+  [[nodiscard]] uint8_t Authority() const { return buffer[7]; }
+  [[nodiscard]] size_t SubAuthorityCount() const { return buffer[1]; }
+  [[nodiscard]] uint32_t SubAuthority(size_t i) const {
+    auto p = buffer + 8 + i * 4;
+    return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 |
+           static_cast<uint32_t>(p[3]) << 24;
+  }
+  [[nodiscard]] std::wstring String() const;
+  void Assign(uint8_t authority, std::span<const uint32_t> subauthorities);
+
+private:
+  alignas(uint32_t) uint8_t buffer[8 + max_subauthorities * 4]{0};
+};
+
+// HashCapabilityRids always hashes name, DeriveCapabilityRids answers capabilities.hpp names from a precomputed table
+void HashCapabilityRids(std::wstring_view name, capability_rids_t &rids);
+void DeriveCapabilityRids(std::wstring_view name, capability_rids_t &rids);
+void DeriveCapabilitySids(std::wstring_view name, SidBuffer *group, SidBuffer *capability);
+// bulk variants append one SID per name, either output may be null
+void DeriveCapabilitySids(std::span<const std::wstring> names, std::vector<SidBuffer> *groups,
+                          std::vector<SidBuffer> *capabilities);
+
+// DeriveAppContainerSid matches DeriveAppContainerSidFromAppContainerName: S-1-15-2-<rids>, the rids being the first 7
+// little-endian DWORDs of SHA-256 of the lower-cased UTF-16LE name
+constexpr size_t appcontainer_rids_size = 7;
+void DeriveAppContainerSid(std::wstring_view appid, SidBuffer &sid);
+} // namespace wsudo::exec
+
+#endif
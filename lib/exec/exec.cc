@@ -30,7 +30,7 @@ bool execute(command &cmd, bela::error_code &ec) {
     si.wShowWindow = SW_HIDE;
   }
   if (CreateProcessW(string_nullable(cmd.path), ea.data(), nullptr, nullptr, FALSE, createflags,
-                     string_nullable(cmd.env), string_nullable(cmd.cwd), &si, &pi) != TRUE) {
+                     env_nullable(cmd.env), string_nullable(cmd.cwd), &si, &pi) != TRUE) {
     ec = bela::make_system_error_code(L"CreateProcessAsUserW");
     return false;
   }
@@ -63,7 +63,7 @@ bool execute(HANDLE hToken, bool desktop, command &cmd, bela::error_code &ec) {
     si.wShowWindow = SW_HIDE;
   }
   if (CreateProcessAsUserW(hToken, string_nullable(cmd.path), ea.data(), nullptr, nullptr, FALSE, createflags,
-                           string_nullable(cmd.env), string_nullable(cmd.cwd), &si, &pi) != TRUE) {
+                           env_nullable(cmd.env), string_nullable(cmd.cwd), &si, &pi) != TRUE) {
     ec = bela::make_system_error_code(L"CreateProcessAsUserW");
     return false;
   }
@@ -2,10 +2,13 @@
 #ifndef WSUDO_EXEC_HPP
 #define WSUDO_EXEC_HPP
 #include <bela/env.hpp>
+#include <bela/pathindex.hpp>
 
 namespace wsudo::exec {
 constexpr const wchar_t *string_nullable(std::wstring_view str) { return str.empty() ? nullptr : str.data(); }
 constexpr wchar_t *string_nullable(std::wstring &str) { return str.empty() ? nullptr : str.data(); }
+// CreateProcess only reads the environment block, so a view of the caller's block is passed as is
+inline void *env_nullable(std::wstring_view env) { return env.empty() ? nullptr : const_cast<wchar_t *>(env.data()); }
 
 enum class privilege_t : uint8_t {
   none,
@@ -27,7 +30,7 @@ enum class visible_t : uint8_t {
 struct command {
   std::wstring path;
   std::wstring cwd;
-  std::wstring env;
+  std::wstring_view env; // environment block, owned by the caller until execute returns
   std::vector<std::wstring> argv;
   uint32_t pid{0};
   privilege_t priv{privilege_t::standard};
@@ -42,7 +45,7 @@ struct appcommand {
   std::wstring appmanifest;
   std::wstring sid;
   std::wstring folder;
-  std::wstring env;
+  std::wstring_view env; // environment block, owned by the caller until execute returns
   std::vector<std::wstring> argv;
   std::vector<std::wstring> allowdirs;
   std::vector<std::wstring> regdirs;
@@ -69,7 +72,9 @@ inline bool IsUserAdministratorsGroup() {
   return b == TRUE;
 }
 
-bool SplitArgv(std::wstring_view cmd, std::wstring &path, std::vector<std::wstring> &argv, bela::error_code &ec);
+// SplitArgv tokenizes cmd and resolves argv[0], through index when the caller keeps an executable index
+bool SplitArgv(std::wstring_view cmd, std::wstring &path, std::vector<std::wstring> &argv, bela::error_code &ec,
+               bela::env::ExecutableIndex *index = nullptr);
 } // namespace wsudo::exec
 
 #endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+//
+#include <bela/hash.hpp>
+#include <algorithm>
+#include <vector>
+#include "profilecache.hpp"
+
+namespace wsudo::exec {
+std::wstring CapabilityFingerprint(std::span<const sid_bytes_t> capabilities) {
+  std::vector<sid_bytes_t> sorted(capabilities.begin(), capabilities.end());
+  std::sort(sorted.begin(), sorted.end(), [](sid_bytes_t a, sid_bytes_t b) {
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+  });
+  bela::hash::sha256::Hasher h;
+  h.Initialize();
+  for (const auto &s : sorted) {
+    // a SID carries its own length, no separator needed
+    h.Update(s.data(), s.size());
+  }
+  return h.Finalize();
+}
+
+profile_status ProfileCache::Acquire(std::wstring_view appid, std::span<const sid_bytes_t> capabilities,
+                                     SidBuffer &sid) {
+  DeriveAppContainerSid(appid, sid);
+  auto fingerprint = CapabilityFingerprint(capabilities);
+  if (std::wstring recorded; store.Lookup(appid, sid, recorded) && recorded == fingerprint) {
+    return profile_status::reused;
+  }
+  if (!store.Recreate(appid, capabilities)) {
+    return profile_status::failed;
+  }
+  // a lost record only costs the next launch another Recreate
+  store.Record(appid, fingerprint);
+  return profile_status::created;
+}
+} // namespace wsudo::exec
@@ -0,0 +1,47 @@
+// AppContainer profile reuse
+#ifndef WSUDO_PROFILECACHE_HPP
+#define WSUDO_PROFILECACHE_HPP
+#include <span>
+#include <string>
+#include <string_view>
+#include "capabilitysid.hpp"
+
+namespace wsudo::exec {
+using sid_bytes_t = std::span<const uint8_t>;
+
+// CapabilityFingerprint hashes the capability SIDs a profile is created with, the order of the SIDs does not matter
+std::wstring CapabilityFingerprint(std::span<const sid_bytes_t> capabilities);
+
+// ProfileStore owns the AppContainer profiles, on Windows the profile repository plus a recorded fingerprint per appid.
+// Tests use an in-memory store.
+class ProfileStore {
+public:
+  virtual ~ProfileStore() = default;
+  // Lookup returns the fingerprint recorded for appid, false when there is no profile with the SID sid
+  virtual bool Lookup(std::wstring_view appid, const SidBuffer &sid, std::wstring &fingerprint) = 0;
+  // Recreate deletes the profile named appid if one exists and creates it with capabilities
+  virtual bool Recreate(std::wstring_view appid, std::span<const sid_bytes_t> capabilities) = 0;
+  virtual bool Record(std::wstring_view appid, std::wstring_view fingerprint) = 0;
+};
+
+enum class profile_status : uint8_t {
+  reused,
+  created,
+  failed,
+};
+
+// ProfileCache keeps an AppContainer profile across launches as long as it is asked for the same capabilities. The
+// AppContainer SID is derived from the appid, a reused profile costs no profile API call.
+class ProfileCache {
+public:
+  explicit ProfileCache(ProfileStore &store_) : store(store_) {}
+  ProfileCache(const ProfileCache &) = delete;
+  ProfileCache &operator=(const ProfileCache &) = delete;
+  profile_status Acquire(std::wstring_view appid, std::span<const sid_bytes_t> capabilities, SidBuffer &sid);
+
+private:
+  ProfileStore &store;
+};
+} // namespace wsudo::exec
+
+#endif
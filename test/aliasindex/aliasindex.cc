@@ -0,0 +1,114 @@
+// wsudo alias lookup: parsing Privexec.json per launch against probing the compiled wsudo-alias.index
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <json.hpp>
+#include "../../wsudo/aliasindex.hpp"
+
+constexpr size_t aliasCount = 10000;
+
+std::wstring Widen(std::string_view s) { return std::wstring(s.begin(), s.end()); }
+
+std::string SyntheticJson() {
+  nlohmann::json root, av;
+  for (size_t i = 0; i < aliasCount; i++) {
+    auto n = std::to_string(i);
+    nlohmann::json a;
+    a["name"] = "tool-" + n;
+    a["target"] = "\"%ProgramFiles%\\Vendor " + n + "\\bin\\tool" + n + ".exe\" --profile default";
+    a["description"] = "Synthetic alias " + n;
+    av.emplace_back(std::move(a));
+  }
+  root["alias"] = av;
+  return root.dump(4);
+}
+
+// what wsudo did per launch: parse everything, keep every alias as wide strings, then look up one
+std::optional<std::wstring> ParseLookup(const std::string &text, std::wstring_view al) {
+  std::unordered_map<std::wstring, std::pair<std::wstring, std::wstring>> alias;
+  auto json = nlohmann::json::parse(text, nullptr, true, true);
+  for (auto &cmd : json["alias"]) {
+    alias.emplace(Widen(cmd["name"].get<std::string_view>()),
+                  std::make_pair(Widen(cmd["target"].get<std::string_view>()),
+                                 Widen(cmd["description"].get<std::string_view>())));
+  }
+  if (auto it = alias.find(std::wstring(al)); it != alias.end()) {
+    return it->second.first;
+  }
+  return std::nullopt;
+}
+
+template <typename F> double measure(int rounds, F &&fn) {
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    fn();
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 1e6 / rounds;
+}
+
+int main() {
+  int failed = 0;
+  auto text = SyntheticJson();
+  const wsudo::AliasStamp stamp{static_cast<int64_t>(text.size()), 133000000000000000};
+  wsudo::AliasIndexWriter w;
+  auto json = nlohmann::json::parse(text);
+  for (auto &cmd : json["alias"]) {
+    w.Add(Widen(cmd["name"].get<std::string_view>()), Widen(cmd["target"].get<std::string_view>()));
+  }
+  auto index = w.Finish(stamp);
+  std::span<const uint8_t> bytes(reinterpret_cast<const uint8_t *>(index.data()), index.size());
+  wsudo::AliasIndexView view;
+  if (!view.Attach(bytes, stamp) || view.size() != aliasCount) {
+    std::fprintf(stderr, "index does not attach\n");
+    return 1;
+  }
+  for (size_t i = 0; i < aliasCount; i++) {
+    auto n = std::to_string(i);
+    auto want = Widen("\"%ProgramFiles%\\Vendor " + n + "\\bin\\tool" + n + ".exe\" --profile default");
+    auto got = view.Find(Widen((i % 2 == 0 ? "tool-" : "TOOL-") + n));
+    if (!got || !std::equal(got->begin(), got->end(), want.begin(), want.end())) {
+      std::fprintf(stderr, "alias tool-%s not resolved\n", n.data());
+      failed++;
+    }
+  }
+  for (auto miss : {L"tool-", L"tool-10000", L"tool_1", L""}) {
+    if (view.Find(miss)) {
+      std::fprintf(stderr, "unexpected alias %ls\n", miss);
+      failed++;
+    }
+  }
+  // a stale stamp, a truncated file and a foreign file must all fall back to Privexec.json
+  wsudo::AliasIndexView other;
+  if (other.Attach(bytes, {stamp.size + 1, stamp.mtime}) || other.Attach(bytes.first(bytes.size() / 2), stamp) ||
+      other.Attach(bytes.first(16), stamp) || other.Find(L"tool-1")) {
+    std::fprintf(stderr, "accepted an unusable index\n");
+    failed++;
+  }
+  // later entries replace earlier ones ignoring case, like insert_or_assign on the case-insensitive map
+  wsudo::AliasIndexWriter dup;
+  dup.Add(L"Edit-Hosts", L"old");
+  dup.Add(L"edit-hosts", L"new");
+  auto dupIndex = dup.Finish(stamp);
+  wsudo::AliasIndexView dupView;
+  if (!dupView.Attach({reinterpret_cast<const uint8_t *>(dupIndex.data()), dupIndex.size()}, stamp) ||
+      dupView.Find(L"EDIT-HOSTS") != std::u16string_view(u"new")) {
+    std::fprintf(stderr, "duplicate alias not replaced\n");
+    failed++;
+  }
+
+  auto parse = measure(20, [&] { ParseLookup(text, L"tool-5000"); });
+  auto compile = measure(20, [&] { w.Finish(stamp); });
+  auto probe = measure(200000, [&] {
+    wsudo::AliasIndexView v;
+    v.Attach(bytes, stamp);
+    v.Find(L"tool-5000");
+  });
+  std::printf("%zu aliases, Privexec.json %zu bytes, wsudo-alias.index %zu bytes\n", aliasCount, text.size(),
+              index.size());
+  std::printf("parse and lookup\t%.2f us\ncompile index\t\t%.2f us\nattach and probe\t%.3f us\n", parse, compile,
+              probe);
+  std::printf("alias index: %d failed\n", failed);
+  return failed == 0 ? 0 : 1;
+}
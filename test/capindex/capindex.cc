@@ -0,0 +1,153 @@
+// KnownCapabilityNames: minimal perfect hash against the linear scan, and the generator of include/capabilitymph.hpp
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <capabilityindex.hpp>
+
+// the scan IsKnownCapabilityNames used to do
+ptrdiff_t ScanCapabilityIndex(std::wstring_view name) {
+  for (size_t i = 0; i < std::size(priv::KnownCapabilityNames); i++) {
+    if (name == priv::KnownCapabilityNames[i]) {
+      return static_cast<ptrdiff_t>(i);
+    }
+  }
+  return -1;
+}
+
+// Hash and displace: the largest first-level buckets get a seed first that sends their names to free slots, a bucket
+// holding a single name stores its index directly
+int PrintTable() {
+  constexpr auto n = std::size(priv::KnownCapabilityNames);
+  std::vector<uint32_t> hashes(n);
+  std::vector<std::vector<size_t>> buckets(n);
+  for (size_t i = 0; i < n; i++) {
+    hashes[i] = priv::capability_hash(priv::KnownCapabilityNames[i]);
+    buckets[priv::capability_mix(hashes[i], 0) % n].push_back(i);
+  }
+  std::vector<size_t> order(n);
+  for (size_t i = 0; i < n; i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+  std::vector<int32_t> displacements(n, 0);
+  std::vector<bool> used(n, false);
+  std::vector<uint16_t> indexes(n, 0);
+  std::vector<size_t> slots;
+  for (auto b : order) {
+    const auto &bucket = buckets[b];
+    if (bucket.size() > 1) {
+      for (uint32_t seed = 1;; seed++) {
+        if (seed > 0xFFFFFF) {
+          // two names sharing the 32-bit hash can never be separated, capability_hash needs to change
+          std::fwprintf(stderr, L"no seed separates bucket of %ls\n", priv::KnownCapabilityNames[bucket.front()]);
+          return 1;
+        }
+        slots.clear();
+        for (auto i : bucket) {
+          auto slot = priv::capability_mix(hashes[i], seed) % n;
+          if (used[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+            break;
+          }
+          slots.push_back(slot);
+        }
+        if (slots.size() == bucket.size()) {
+          for (size_t k = 0; k < slots.size(); k++) {
+            used[slots[k]] = true;
+            indexes[slots[k]] = static_cast<uint16_t>(bucket[k]);
+          }
+          displacements[b] = static_cast<int32_t>(seed);
+          break;
+        }
+      }
+      continue;
+    }
+    if (bucket.size() == 1) {
+      displacements[b] = -static_cast<int32_t>(bucket.front()) - 1;
+    }
+  }
+  std::wprintf(L"// Code generated by capindex_bench --table. DO NOT EDIT.\n"
+               L"#ifndef PRIVEXEC_CAPABILITYMPH_HPP\n"
+               L"#define PRIVEXEC_CAPABILITYMPH_HPP\n"
+               L"#include <cstdint>\n\n"
+               L"namespace priv {\n"
+               L"constexpr int32_t KnownCapabilityDisplacements[] = {");
+  for (size_t i = 0; i < n; i++) {
+    std::wprintf(i % 12 == 0 ? L"\n    %d," : L" %d,", displacements[i]);
+  }
+  std::wprintf(L"\n};\nconstexpr uint16_t KnownCapabilitySlots[] = {");
+  for (size_t i = 0; i < n; i++) {
+    std::wprintf(i % 16 == 0 ? L"\n    %u," : L" %u,", static_cast<unsigned>(indexes[i]));
+  }
+  std::wprintf(L"\n};\n} // namespace priv\n\n#endif\n");
+  return 0;
+}
+
+template <typename F> double measure(F &&fn) {
+  auto begin = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "--table") == 0) {
+    return PrintTable();
+  }
+  // every index must round-trip, in any letter case, and misses must stay misses
+  int failed = 0;
+  std::vector<std::wstring> queries;
+  for (size_t i = 0; i < std::size(priv::KnownCapabilityNames); i++) {
+    std::wstring upper(priv::KnownCapabilityNames[i]);
+    for (auto &c : upper) {
+      c = (c >= L'a' && c <= L'z') ? static_cast<wchar_t>(c - (L'a' - L'A')) : c;
+    }
+    if (priv::LookupCapabilityIndex(priv::KnownCapabilityNames[i]) != static_cast<ptrdiff_t>(i) ||
+        priv::LookupCapabilityIndex(upper) != static_cast<ptrdiff_t>(i)) {
+      std::fwprintf(stderr, L"lookup mismatch: %ls\n", priv::KnownCapabilityNames[i]);
+      failed++;
+    }
+    queries.emplace_back(priv::KnownCapabilityNames[i]);
+    queries.emplace_back(std::wstring(priv::KnownCapabilityNames[i]) + L"X");
+  }
+  for (auto miss : {L"", L"internetClient2", L"notACapability", L"ID_CAP"}) {
+    if (priv::IsKnownCapabilityName(miss)) {
+      std::fwprintf(stderr, L"unexpected hit: %ls\n", miss);
+      failed++;
+    }
+  }
+  // compile-time evaluation only, the result is checked above so --table still builds against a stale table
+  static_assert(priv::LookupCapabilityIndex(L"internetClient") >= -1, "constexpr lookup");
+  if (failed != 0) {
+    std::printf("capability index: %d failed\n", failed);
+    return 1;
+  }
+  int rounds = 200;
+  if (argc > 1) {
+    rounds = (std::max)(atoi(argv[1]), 1);
+  }
+  // half hits, half misses sharing a known prefix, the scan's worst case
+  ptrdiff_t sink = 0;
+  auto scanSeconds = measure([&] {
+    for (int r = 0; r < rounds; r++) {
+      for (const auto &q : queries) {
+        sink += ScanCapabilityIndex(q);
+      }
+    }
+  });
+  auto mphSeconds = measure([&] {
+    for (int r = 0; r < rounds; r++) {
+      for (const auto &q : queries) {
+        sink += priv::LookupCapabilityIndex(q);
+      }
+    }
+  });
+  auto lookups = static_cast<double>(rounds) * static_cast<double>(queries.size());
+  std::printf("names: %zu lookups: %.0f (sink %td)\n", std::size(priv::KnownCapabilityNames), lookups, sink);
+  std::printf("mode\tns/lookup\n");
+  std::printf("scan\t%.1f\n", scanSeconds * 1e9 / lookups);
+  std::printf("mph\t%.1f\n", mphSeconds * 1e9 / lookups);
+  return 0;
+}
@@ -0,0 +1,72 @@
+// capability SID vectors, and the generator of include/capabilitysids.hpp
+#include <cstdio>
+#include <cstring>
+#include <capabilities.hpp>
+#include <capabilitysids.hpp>
+#include <capabilitysid.hpp>
+
+struct capability_vector {
+  std::wstring_view name;
+  std::wstring_view group;
+  std::wstring_view capability;
+};
+
+// registryRead grants LPAC access in the registry ACLs of stock Windows, the group SID reuses its hash
+constexpr capability_vector vectors[] = {
+    {L"registryRead", L"S-1-5-32-1065365936-1281604716-3511738428-1654721687-432734479-3232135806-4053264122-3456934681",
+     L"S-1-15-3-1024-1065365936-1281604716-3511738428-1654721687-432734479-3232135806-4053264122-3456934681"},
+};
+
+int PrintTable() {
+  std::wprintf(L"// Code generated by capsid_test --table. DO NOT EDIT.\n"
+                        L"#ifndef PRIVEXEC_CAPABILITYSIDS_HPP\n"
+                        L"#define PRIVEXEC_CAPABILITYSIDS_HPP\n"
+                        L"#include <cstdint>\n\n"
+                        L"namespace priv {\n"
+                        L"// KnownCapabilityRids[i] holds the capability hash of KnownCapabilityNames[i]\n"
+                        L"constexpr uint32_t KnownCapabilityRids[][8] = {\n");
+  for (auto name : priv::KnownCapabilityNames) {
+    wsudo::exec::capability_rids_t rids;
+    wsudo::exec::HashCapabilityRids(name, rids);
+    std::wprintf(L"    {%uU, %uU, %uU, %uU, %uU, %uU, %uU, %uU}, // %ls\n", rids[0], rids[1], rids[2], rids[3], rids[4],
+                 rids[5], rids[6], rids[7], name);
+  }
+  std::wprintf(L"};\n} // namespace priv\n\n#endif\n");
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "--table") == 0) {
+    return PrintTable();
+  }
+  int failed = 0;
+  for (const auto &v : vectors) {
+    wsudo::exec::SidBuffer group;
+    wsudo::exec::SidBuffer capability;
+    wsudo::exec::DeriveCapabilitySids(v.name, &group, &capability);
+    if (group.String() != v.group || capability.String() != v.capability) {
+      std::fwprintf(stderr, L"%ls: group %ls capability %ls\n", std::wstring(v.name).data(), group.String().data(),
+                    capability.String().data());
+      failed++;
+    }
+  }
+  // the precomputed table must agree with hashing, in any letter case
+  for (size_t i = 0; i < std::size(priv::KnownCapabilityNames); i++) {
+    wsudo::exec::capability_rids_t hashed;
+    wsudo::exec::HashCapabilityRids(priv::KnownCapabilityNames[i], hashed);
+    if (memcmp(hashed, priv::KnownCapabilityRids[i], sizeof(hashed)) != 0) {
+      std::fwprintf(stderr, L"table mismatch: %ls\n", priv::KnownCapabilityNames[i]);
+      failed++;
+    }
+  }
+  std::vector<std::wstring> names{L"REGISTRYREAD", L"registryread", L"notAKnownCapability"};
+  std::vector<wsudo::exec::SidBuffer> capabilities;
+  wsudo::exec::DeriveCapabilitySids(names, nullptr, &capabilities);
+  if (capabilities.size() != names.size() || capabilities[0].String() != vectors[0].capability ||
+      capabilities[1].String() != vectors[0].capability || capabilities[2].size() != 48) {
+    std::fwprintf(stderr, L"bulk derivation mismatch\n");
+    failed++;
+  }
+  std::wprintf(L"capability sid: %d failed\n", failed);
+  return failed == 0 ? 0 : 1;
+}
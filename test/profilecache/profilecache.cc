@@ -0,0 +1,88 @@
+// AppContainer SID derivation and profile reuse against an in-memory profile store
+#include <cstdio>
+#include <map>
+#include <profilecache.hpp>
+
+// the SID of the legacy Edge package, as found on AppContainer ACLs
+constexpr std::wstring_view edgeAppid = L"Microsoft.MicrosoftEdge_8wekyb3d8bbwe";
+constexpr std::wstring_view edgeSid =
+    L"S-1-15-2-3624051433-2125758914-1423191267-1740899205-1073925389-3782572162-737981194";
+
+class FakeStore : public wsudo::exec::ProfileStore {
+public:
+  bool Lookup(std::wstring_view appid, const wsudo::exec::SidBuffer &sid, std::wstring &fingerprint) override {
+    auto it = profiles.find(std::wstring(appid));
+    if (it == profiles.end() || it->second.sid != sid.String()) {
+      return false;
+    }
+    fingerprint = it->second.fingerprint;
+    return true;
+  }
+  bool Recreate(std::wstring_view appid, std::span<const wsudo::exec::sid_bytes_t>) override {
+    recreated++;
+    if (failing) {
+      return false;
+    }
+    wsudo::exec::SidBuffer sid;
+    wsudo::exec::DeriveAppContainerSid(appid, sid);
+    profiles[std::wstring(appid)] = profile{sid.String(), L""};
+    return true;
+  }
+  bool Record(std::wstring_view appid, std::wstring_view fingerprint) override {
+    profiles[std::wstring(appid)].fingerprint = fingerprint;
+    return true;
+  }
+  struct profile {
+    std::wstring sid;
+    std::wstring fingerprint;
+  };
+  std::map<std::wstring, profile> profiles;
+  int recreated{0};
+  bool failing{false};
+};
+
+int failed = 0;
+
+void expect(bool ok, const char *what) {
+  if (!ok) {
+    std::fprintf(stderr, "FAIL: %s\n", what);
+    failed++;
+  }
+}
+
+int main() {
+  using wsudo::exec::profile_status;
+  wsudo::exec::SidBuffer sid;
+  wsudo::exec::DeriveAppContainerSid(edgeAppid, sid);
+  expect(sid.String() == edgeSid, "edge appcontainer sid");
+  expect(sid.size() == 40, "appcontainer sid size");
+
+  std::vector<wsudo::exec::SidBuffer> caps;
+  std::vector<std::wstring> names{L"internetClient", L"registryRead", L"lpacCom"};
+  wsudo::exec::DeriveCapabilitySids(names, nullptr, &caps);
+  std::vector<wsudo::exec::sid_bytes_t> bytes;
+  for (const auto &c : caps) {
+    bytes.emplace_back(static_cast<const uint8_t *>(c.data()), c.size());
+  }
+  std::vector<wsudo::exec::sid_bytes_t> reversed(bytes.rbegin(), bytes.rend());
+  expect(wsudo::exec::CapabilityFingerprint(bytes) == wsudo::exec::CapabilityFingerprint(reversed),
+         "fingerprint ignores order");
+  expect(wsudo::exec::CapabilityFingerprint(bytes) != wsudo::exec::CapabilityFingerprint({bytes.data(), 2}),
+         "fingerprint covers every capability");
+
+  FakeStore store;
+  wsudo::exec::ProfileCache cache(store);
+  expect(cache.Acquire(L"Privexec.Test", bytes, sid) == profile_status::created, "first launch creates");
+  expect(cache.Acquire(L"Privexec.Test", reversed, sid) == profile_status::reused, "same capabilities reuse");
+  expect(cache.Acquire(L"Privexec.Test", {bytes.data(), 2}, sid) == profile_status::created,
+         "changed capabilities recreate");
+  expect(cache.Acquire(L"Privexec.Test", {bytes.data(), 2}, sid) == profile_status::reused, "recreated is reused");
+  expect(store.recreated == 2, "profile api calls");
+  // a profile removed behind our back is created again even though the fingerprint is still recorded
+  store.profiles[L"Privexec.Test"].sid.clear();
+  expect(cache.Acquire(L"Privexec.Test", {bytes.data(), 2}, sid) == profile_status::created, "missing profile");
+  store.failing = true;
+  expect(cache.Acquire(L"Privexec.Other", bytes, sid) == profile_status::failed, "store failure");
+  std::printf("profile cache: %d failed\n", failed);
+  return failed == 0 ? 0 : 1;
+}
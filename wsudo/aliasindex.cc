@@ -0,0 +1,170 @@
+////
+#include <cstring>
+#include "aliasindex.hpp"
+
+namespace wsudo {
+constexpr char indexMagic[4] = {'W', 'S', 'A', 'I'};
+constexpr uint32_t indexVersion = 1;
+// magic, version, stamp size, stamp mtime, count, bucket mask, string code units
+constexpr size_t headerSize = 4 + 4 + 8 + 8 + 4 + 4 + 4;
+constexpr size_t entrySize = 5 * 4;
+
+constexpr char16_t asciiLower(char16_t c) { return c >= u'A' && c <= u'Z' ? static_cast<char16_t>(c + 32) : c; }
+
+template <typename C> uint32_t foldHash(std::basic_string_view<C> s) {
+  uint32_t h = 2166136261U;
+  for (auto c : s) {
+    auto u = asciiLower(static_cast<char16_t>(c));
+    h = (h ^ (u & 0xFF)) * 16777619U;
+    h = (h ^ (u >> 8)) * 16777619U;
+  }
+  return h;
+}
+
+template <typename T> void store(std::string &out, T v) {
+  char b[sizeof(T)];
+  std::memcpy(b, &v, sizeof(T));
+  out.append(b, sizeof(T));
+}
+
+template <typename T> T load(const uint8_t *p) {
+  T v;
+  std::memcpy(&v, p, sizeof(T));
+  return v;
+}
+
+void AliasIndexWriter::Add(std::wstring_view name, std::wstring_view target) {
+  auto append = [&](std::wstring_view s) {
+    auto offset = static_cast<uint32_t>(strings.size());
+    for (auto c : s) {
+      strings.push_back(static_cast<char16_t>(c));
+    }
+    return offset;
+  };
+  record r{foldHash(name), 0, static_cast<uint32_t>(name.size()), 0, static_cast<uint32_t>(target.size())};
+  r.name = append(name);
+  r.target = append(target);
+  records.emplace_back(r);
+}
+
+std::string AliasIndexWriter::Finish(const AliasStamp &stamp) const {
+  // load factor at most one half keeps probe sequences short
+  uint32_t buckets = 16;
+  while (buckets < records.size() * 2) {
+    buckets <<= 1;
+  }
+  auto mask = buckets - 1;
+  std::vector<uint32_t> table(buckets, 0);
+  std::u16string_view pool(strings);
+  for (size_t i = 0; i < records.size(); i++) {
+    const auto &r = records[i];
+    auto name = pool.substr(r.name, r.nameLength);
+    for (auto b = r.hash & mask;; b = (b + 1) & mask) {
+      if (table[b] == 0) {
+        table[b] = static_cast<uint32_t>(i + 1);
+        break;
+      }
+      // a later duplicate replaces the earlier one, as insert_or_assign would
+      const auto &o = records[table[b] - 1];
+      auto other = pool.substr(o.name, o.nameLength);
+      if (o.hash == r.hash && other.size() == name.size() &&
+          std::equal(name.begin(), name.end(), other.begin(),
+                     [](char16_t x, char16_t y) { return asciiLower(x) == asciiLower(y); })) {
+        table[b] = static_cast<uint32_t>(i + 1);
+        break;
+      }
+    }
+  }
+  std::string out;
+  out.reserve(headerSize + buckets * 4 + records.size() * entrySize + strings.size() * 2);
+  out.append(indexMagic, sizeof(indexMagic));
+  store(out, indexVersion);
+  store(out, stamp.size);
+  store(out, stamp.mtime);
+  store(out, static_cast<uint32_t>(records.size()));
+  store(out, mask);
+  store(out, static_cast<uint32_t>(strings.size()));
+  for (auto b : table) {
+    store(out, b);
+  }
+  for (const auto &r : records) {
+    store(out, r.hash);
+    store(out, r.name);
+    store(out, r.nameLength);
+    store(out, r.target);
+    store(out, r.targetLength);
+  }
+  for (auto c : strings) {
+    store(out, static_cast<uint16_t>(c));
+  }
+  return out;
+}
+
+bool AliasIndexView::Attach(std::span<const uint8_t> data, const AliasStamp &stamp) {
+  if (data.size() < headerSize || std::memcmp(data.data(), indexMagic, sizeof(indexMagic)) != 0 ||
+      load<uint32_t>(data.data() + 4) != indexVersion) {
+    return false;
+  }
+  if (AliasStamp{load<int64_t>(data.data() + 8), load<int64_t>(data.data() + 16)} != stamp) {
+    return false;
+  }
+  auto n = load<uint32_t>(data.data() + 24);
+  auto m = load<uint32_t>(data.data() + 28);
+  auto units = load<uint32_t>(data.data() + 32);
+  // the mask must describe a power of two table with room for every entry
+  if (m == UINT32_MAX || (m & (m + 1)) != 0 || n > m) {
+    return false;
+  }
+  auto tableEnd = headerSize + (static_cast<uint64_t>(m) + 1) * 4;
+  auto entriesEnd = tableEnd + static_cast<uint64_t>(n) * entrySize;
+  // anything but the exact size is a truncated or foreign file
+  if (entriesEnd + static_cast<uint64_t>(units) * 2 != data.size()) {
+    return false;
+  }
+  buckets = data.data() + headerSize;
+  entries = data.data() + tableEnd;
+  strings = reinterpret_cast<const char16_t *>(data.data() + entriesEnd);
+  stringsLength = units;
+  count = n;
+  mask = m;
+  return true;
+}
+
+std::optional<std::u16string_view> AliasIndexView::Find(std::wstring_view name) const {
+  if (buckets == nullptr) {
+    return std::nullopt;
+  }
+  auto hash = foldHash(name);
+  // a well formed table always has an empty slot, the bound only guards a corrupt one
+  for (uint32_t b = hash & mask, probes = 0; probes <= mask; b = (b + 1) & mask, probes++) {
+    auto slot = load<uint32_t>(buckets + static_cast<size_t>(b) * 4);
+    if (slot == 0 || slot > count) {
+      return std::nullopt;
+    }
+    auto e = entries + static_cast<size_t>(slot - 1) * entrySize;
+    if (load<uint32_t>(e) != hash) {
+      continue;
+    }
+    auto nameOffset = load<uint32_t>(e + 4);
+    auto nameLength = load<uint32_t>(e + 8);
+    auto targetOffset = load<uint32_t>(e + 12);
+    auto targetLength = load<uint32_t>(e + 16);
+    if (static_cast<uint64_t>(nameOffset) + nameLength > stringsLength ||
+        static_cast<uint64_t>(targetOffset) + targetLength > stringsLength) {
+      return std::nullopt;
+    }
+    if (nameLength != name.size()) {
+      continue;
+    }
+    auto s = strings + nameOffset;
+    bool equal = true;
+    for (size_t i = 0; i < name.size() && equal; i++) {
+      equal = asciiLower(s[i]) == asciiLower(static_cast<char16_t>(name[i]));
+    }
+    if (equal) {
+      return std::make_optional(std::u16string_view(strings + targetOffset, targetLength));
+    }
+  }
+  return std::nullopt;
+}
+} // namespace wsudo
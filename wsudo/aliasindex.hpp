@@ -0,0 +1,61 @@
+/////
+#ifndef WSUDO_ALIASINDEX_HPP
+#define WSUDO_ALIASINDEX_HPP
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wsudo {
+// AliasStamp identifies the Privexec.json an alias index was compiled from
+struct AliasStamp {
+  int64_t size{0};
+  int64_t mtime{0};
+  bool operator==(const AliasStamp &) const = default;
+};
+
+// AliasIndexWriter compiles aliases into the wsudo-alias.index layout:
+//   header   magic "WSAI", version, AliasStamp, count, bucket mask, string code units
+//   buckets  uint32 entry number + 1 per slot, 0 is empty, open addressing with linear probing
+//   entries  hash, name offset and length, target offset and length
+//   strings  UTF-16LE code units the entries point into
+// Names are hashed and compared ignoring ASCII case, like bela::EqualsIgnoreCase.
+class AliasIndexWriter {
+public:
+  void Add(std::wstring_view name, std::wstring_view target);
+  std::string Finish(const AliasStamp &stamp) const;
+
+private:
+  struct record {
+    uint32_t hash;
+    uint32_t name;
+    uint32_t nameLength;
+    uint32_t target;
+    uint32_t targetLength;
+  };
+  std::vector<record> records;
+  std::u16string strings;
+};
+
+// AliasIndexView probes a compiled index in place, usually a read-only mapping of wsudo-alias.index
+class AliasIndexView {
+public:
+  // Attach validates the header and table bounds, false when data is not an index compiled from stamp
+  bool Attach(std::span<const uint8_t> data, const AliasStamp &stamp);
+  std::optional<std::u16string_view> Find(std::wstring_view name) const;
+  [[nodiscard]] size_t size() const { return count; }
+
+private:
+  const uint8_t *entries{nullptr};
+  const uint8_t *buckets{nullptr};
+  const char16_t *strings{nullptr};
+  size_t stringsLength{0};
+  uint32_t count{0};
+  uint32_t mask{0};
+};
+} // namespace wsudo
+
+#endif
@@ -0,0 +1,123 @@
+////
+#include <bela/codecvt.hpp>
+#include <bela/numbers.hpp>
+#include <bela/str_cat_narrow.hpp>
+#include <bela/io.hpp>
+#include <bela/pe.hpp>
+#include <bela/path.hpp>
+#include <bela/terminal.hpp>
+#include <vfsenv.hpp>
+#include <filesystem>
+#include "subsystem.hpp"
+#include "wsudo.hpp"
+
+namespace wsudo {
+// every launch adds at most one entry, start over rather than grow without bound
+constexpr size_t maximumEntries = 512;
+
+inline std::wstring CacheFile() { return priv::PathSearcher::Instance().JoinEtc(L"wsudo-subsystem.cache"); }
+
+inline int64_t FileTimeValue(const FILETIME &ft) {
+  return static_cast<int64_t>(static_cast<uint64_t>(ft.dwHighDateTime) << 32 | ft.dwLowDateTime);
+}
+
+// parseEntry parses one 'console<TAB>size<TAB>mtime<TAB>path' line
+bool parseEntry(std::string_view line, std::wstring &path, SubsystemCache::Entry &e) {
+  std::string_view fields[3];
+  for (auto &f : fields) {
+    auto pos = line.find('\t');
+    if (pos == std::string_view::npos) {
+      return false;
+    }
+    f = line.substr(0, pos);
+    line.remove_prefix(pos + 1);
+  }
+  if (line.empty() || (fields[0] != "0" && fields[0] != "1") || !bela::SimpleAtoi(fields[1], &e.size) ||
+      !bela::SimpleAtoi(fields[2], &e.mtime)) {
+    return false;
+  }
+  e.console = fields[0] == "1";
+  path = bela::ToWide(line);
+  return true;
+}
+
+SubsystemCache::~SubsystemCache() {
+  if (updated) {
+    Apply();
+  }
+}
+
+bool SubsystemCache::Initialize() {
+  auto file = CacheFile();
+  std::string text;
+  bela::error_code ec;
+  if (!bela::io::ReadFile(file, text, ec)) {
+    DbgPrint(L"subsystem cache %s: %s", file, ec.message);
+    return false;
+  }
+  std::string_view sv(text);
+  std::wstring path;
+  while (!sv.empty()) {
+    auto pos = sv.find('\n');
+    auto line = sv.substr(0, pos);
+    sv.remove_prefix(pos == std::string_view::npos ? sv.size() : pos + 1);
+    if (!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    Entry e;
+    if (parseEntry(line, path, e)) {
+      entries.insert_or_assign(std::move(path), e);
+    }
+  }
+  return true;
+}
+
+bool SubsystemCache::IsConsole(std::wstring_view path) {
+  // relative, '/' separated or '..' spellings of one program share its entry, the map already ignores ASCII case.
+  // GetFullPathNameW wants a terminated string
+  auto p = bela::PathAbsolute(std::wstring(path));
+  if (p.empty()) {
+    p.assign(path);
+  }
+  WIN32_FILE_ATTRIBUTE_DATA fa;
+  if (GetFileAttributesExW(p.data(), GetFileExInfoStandard, &fa) != TRUE) {
+    return bela::pe::IsSubsystemConsole(path);
+  }
+  auto size = static_cast<int64_t>(static_cast<uint64_t>(fa.nFileSizeHigh) << 32 | fa.nFileSizeLow);
+  auto mtime = FileTimeValue(fa.ftLastWriteTime);
+  if (auto it = entries.find(p); it != entries.end() && it->second.size == size && it->second.mtime == mtime) {
+    DbgPrint(L"subsystem cache hit %s", path);
+    return it->second.console;
+  }
+  auto console = bela::pe::IsSubsystemConsole(path);
+  if (entries.size() >= maximumEntries) {
+    entries.clear();
+  }
+  entries.insert_or_assign(std::move(p), Entry{size, mtime, console});
+  updated = true;
+  return console;
+}
+
+bool SubsystemCache::Apply() {
+  auto file = CacheFile();
+  std::filesystem::path p(file);
+  auto parent = p.parent_path();
+  std::error_code e;
+  if (!std::filesystem::exists(parent, e) && !std::filesystem::create_directories(parent, e)) {
+    DbgPrint(L"subsystem cache unable create dir %s %s", parent.c_str(), bela::from_std_error_code(e).message);
+    return false;
+  }
+  std::string text;
+  for (const auto &[path, entry] : entries) {
+    bela::narrow::StrAppend(&text, entry.console ? "1" : "0", "\t", entry.size, "\t", entry.mtime, "\t",
+                            bela::ToNarrow(path), "\n");
+  }
+  bela::error_code ec;
+  if (!bela::io::WriteTextAtomic(text, file, ec)) {
+    DbgPrint(L"subsystem cache write %s: %s", file, ec.message);
+    return false;
+  }
+  updated = false;
+  return true;
+}
+} // namespace wsudo
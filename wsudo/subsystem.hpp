@@ -0,0 +1,36 @@
+/////
+#ifndef WSUDO_SUBSYSTEM_HPP
+#define WSUDO_SUBSYSTEM_HPP
+#pragma once
+#include <string>
+#include <string_view>
+#include <bela/simulator.hpp>
+
+namespace wsudo {
+// SubsystemCache remembers whether a program is a console program, keyed by full path ignoring ASCII case and validated
+// with the file size and last write time, so launching the same tool again costs one attribute query instead of
+// opening the file.
+class SubsystemCache {
+public:
+  struct Entry {
+    int64_t size{0};
+    int64_t mtime{0};
+    bool console{false};
+  };
+  using value_type = bela::flat_hash_map<std::wstring, Entry, bela::env::StringCaseInsensitiveHash,
+                                         bela::env::StringCaseInsensitiveEq>;
+  SubsystemCache() = default;
+  SubsystemCache(const SubsystemCache &) = delete;
+  SubsystemCache &operator=(const SubsystemCache &) = delete;
+  ~SubsystemCache();
+  bool Initialize();
+  bool IsConsole(std::wstring_view path);
+
+private:
+  bool updated{false};
+  bool Apply();
+  value_type entries;
+};
+} // namespace wsudo
+
+#endif
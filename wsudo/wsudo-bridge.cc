@@ -253,7 +253,7 @@ bool App::ParseArgv(int argc, wchar_t **argv) {
     return false;
   }
   cmd.path = cmd.argv[0];
-  cmd.env.assign(simulator.MakeEnv());
+  cmd.env = simulator.MakeEnvView();
   DbgPrintP(L"resolve path: %s", cmd.path);
   return true;
 }
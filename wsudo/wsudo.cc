@@ -9,9 +9,11 @@
 #include <Shellapi.h>
 #include <Shlobj.h>
 #include <apphelp.hpp>
+#include <vfsenv.hpp>
 //
 #include "wsudo.hpp"
 #include "wsudoalias.hpp"
+#include "subsystem.hpp"
 
 void Version() {
   //
@@ -38,6 +40,7 @@ usage: wsudo command args...
    -L|--lpac           Less Privileged AppContainer mode.
    --disable-alias     Disable Privexec alias, By default, if Privexec exists alias, use it.
    --appid             Set AppContainer ID name (compatible --appname)
+   --path-index        Resolve the command through an index of PATH kept in etc/wsudo-path.index
 
 Select user can use the following flags:
    -a|--appcontainer   AppContainer
@@ -147,7 +150,8 @@ int App::ParseArgv(int argc, wchar_t **argv) {
       .Add(L"appid", bela::required_argument, 1001)
       .Add(L"disable-alias", bela::no_argument, 1002)
       .Add(L"appname", bela::required_argument, 1003)
-      .Add(L"new-console", bela::no_argument, 1004);
+      .Add(L"new-console", bela::no_argument, 1004)
+      .Add(L"path-index", bela::no_argument, 1005);
   bela::error_code ec;
   auto result = pa.Execute(
       [&](int val, const wchar_t *va, const wchar_t *) {
@@ -217,6 +221,9 @@ int App::ParseArgv(int argc, wchar_t **argv) {
           break;
         case 1004:
           break;
+        case 1005:
+          pathindex = true;
+          break;
         default:
           break;
         }
@@ -249,15 +256,18 @@ int App::ParseArgv(int argc, wchar_t **argv) {
   if (disablealias) {
     DbgPrint(L"App Alias is disabled");
   }
+  if (pathindex) {
+    DbgPrint(L"App PATH index is enabled");
+  }
   DbgPrint(L"App visible mode: %s", VisibleName(visible));
   return 0;
 }
 
-bool SplitArgvInternal(std::wstring &path, std::vector<std::wstring> &argv) {
+bool SplitArgvInternal(std::wstring &path, std::vector<std::wstring> &argv, bela::env::ExecutableIndex *index) {
   std::wstring_view arg0(argv[0]);
   auto a0 = bela::WindowsExpandEnv(arg0);
   argv[0].assign(std::move(a0));
-  if (!bela::env::LookPath(argv[0], a0, true)) {
+  if (!(index == nullptr ? bela::env::LookPath(argv[0], a0, true) : bela::env::LookPath(argv[0], a0, *index, true))) {
     bela::FPrintF(stderr, L"%s not found in path\n", argv[0]);
     return false;
   }
@@ -266,27 +276,38 @@ bool SplitArgvInternal(std::wstring &path, std::vector<std::wstring> &argv) {
 }
 
 bool App::SplitArgv() {
+  // with --path-index PATH lookups go through an index persisted next to Privexec.json, directories that changed are
+  // enumerated again. Loading it costs more than probing a command found in the first PATH directories, so probing
+  // stays the default
+  bela::env::ExecutableIndex index;
+  bela::env::ExecutableIndex *indexed = nullptr;
+  std::wstring indexFile;
+  if (pathindex) {
+    indexFile = priv::PathSearcher::Instance().JoinEtc(L"wsudo-path.index");
+    index.Load(indexFile);
+    indexed = &index;
+  }
+  auto saveIndex = bela::finally([&] {
+    if (pathindex && index.Updated() && !index.Save(indexFile)) {
+      DbgPrint(L"unable save path index %s", indexFile);
+    }
+  });
   auto splitArgv = [&]() {
     std::wstring_view arg0(argv[0]);
     if (disablealias) {
       DbgPrint(L"disable alias: %s", arg0);
-      return SplitArgvInternal(path, argv);
-    }
-    wsudo::AliasEngine ae;
-    if (!ae.Initialize()) {
-      DbgPrint(L"unable initialize alias engine");
-      return SplitArgvInternal(path, argv);
+      return SplitArgvInternal(path, argv, indexed);
     }
-    auto al = ae.Target(arg0);
+    auto al = wsudo::LookupAlias(arg0);
     if (!al) {
-      return SplitArgvInternal(path, argv);
+      return SplitArgvInternal(path, argv, indexed);
     }
     DbgPrint(L"App found alias %s", *al);
     std::vector<std::wstring> Argv;
     auto eal = bela::WindowsExpandEnv(*al);
     DbgPrint(L"App expand alias %s", eal);
     bela::error_code ec;
-    if (!wsudo::exec::SplitArgv(eal, path, Argv, ec)) {
+    if (!wsudo::exec::SplitArgv(eal, path, Argv, ec, indexed)) {
       bela::FPrintF(stderr, L"SplitArgv: %s\n", ec.message);
       return false;
     }
@@ -307,7 +328,9 @@ bool App::SplitArgv() {
     return true;
   }
   DbgPrint(L"App real path '%s'", *re);
-  console = bela::pe::IsSubsystemConsole(*re);
+  wsudo::SubsystemCache sc;
+  sc.Initialize();
+  console = sc.IsConsole(*re);
   DbgPrint(L"App (script) subsystem is console %b", console);
   return true;
 }
@@ -316,7 +339,7 @@ int App::AppExecute() {
   wsudo::exec::appcommand cmd;
   cmd.path.assign(std::move(path));
   cmd.argv = std::move(argv);
-  cmd.env.assign(simulator.MakeEnv());
+  cmd.env = simulator.MakeEnvView();
   cmd.appid.assign(std::move(appid));
   cmd.appmanifest.assign(std::move(appx));
   cmd.cwd.assign(std::move(cwd));
@@ -349,7 +372,7 @@ int App::Execute() {
   wsudo::exec::command cmd;
   cmd.path.assign(std::move(path));
   cmd.argv = std::move(argv);
-  cmd.env.assign(simulator.MakeEnv());
+  cmd.env = simulator.MakeEnvView();
   cmd.cwd.assign(std::move(cwd));
   cmd.visible = visible;
   cmd.priv = level;
@@ -75,6 +75,7 @@ struct App {
   wsudo::exec::privilege_t level{wsudo::exec::privilege_t::standard};
   wsudo::exec::visible_t visible{wsudo::exec::visible_t::none};
   bool disablealias{false}; // --disable-alias
+  bool pathindex{false};    // --path-index
   bool lpac{false};
   bool wait{false};
   bool nowait{false};
@@ -5,12 +5,29 @@
 #include <bela/path.hpp>
 #include <bela/terminal.hpp>
 #include <bela/io.hpp>
+#include <bela/mapview.hpp>
 #include <vfsenv.hpp>
 #include <file.hpp>
 #include <filesystem>
 #include "wsudoalias.hpp"
 #include "wsudo.hpp"
 
+namespace wsudo {
+inline std::wstring AliasIndexFile() { return priv::PathSearcher::Instance().JoinEtc(L"wsudo-alias.index"); }
+
+// StatAlias identifies Privexec.json by size and last write time, the index is stamped with both
+bool StatAlias(std::wstring_view file, AliasStamp &stamp) {
+  WIN32_FILE_ATTRIBUTE_DATA fa;
+  if (GetFileAttributesExW(file.data(), GetFileExInfoStandard, &fa) != TRUE) {
+    return false;
+  }
+  stamp.size = static_cast<int64_t>(static_cast<uint64_t>(fa.nFileSizeHigh) << 32 | fa.nFileSizeLow);
+  stamp.mtime = static_cast<int64_t>(static_cast<uint64_t>(fa.ftLastWriteTime.dwHighDateTime) << 32 |
+                                     fa.ftLastWriteTime.dwLowDateTime);
+  return true;
+}
+} // namespace wsudo
+
 wsudo::AliasEngine::~AliasEngine() {
   if (updated) {
     Apply();
@@ -74,11 +91,14 @@ bool wsudo::AliasEngine::Apply() {
     root["alias"] = av;
     auto buf = root.dump(4);
     bela::error_code ec;
-    if (bela::io::WriteTextAtomic(buf, file, ec)) {
+    if (!bela::io::WriteTextAtomic(buf, file, ec)) {
       bela::FPrintF(stderr, L"\x1b[31mAliasEngine::Apply: %s\x1b[0m\n", ec.message);
       return false;
     }
     updated = false;
+    if (AliasStamp stamp; StatAlias(file, stamp)) {
+      Compile(stamp);
+    }
   } catch (const std::exception &e) {
     bela::FPrintF(stderr, L"\x1b[31mAliasEngine::Apply: %s\x1b[0m\n", e.what());
     return false;
@@ -86,6 +106,52 @@ bool wsudo::AliasEngine::Apply() {
   return true;
 }
 
+bool wsudo::AliasEngine::Compile(const AliasStamp &stamp) {
+  AliasIndexWriter w;
+  for (const auto &[name, target] : alias) {
+    w.Add(name, target.target);
+  }
+  auto file = AliasIndexFile();
+  bela::error_code ec;
+  if (!bela::io::WriteTextAtomic(w.Finish(stamp), file, ec)) {
+    DbgPrint(L"alias index write %s: %s", file, ec.message);
+    return false;
+  }
+  return true;
+}
+
+std::optional<std::wstring> wsudo::LookupAlias(std::wstring_view al) {
+  auto file = priv::PathSearcher::Instance().JoinEtc(L"Privexec.json");
+  AliasStamp stamp;
+  if (!StatAlias(file, stamp)) {
+    DbgPrint(L"unable stat %s", file);
+    return std::nullopt;
+  }
+  auto index = AliasIndexFile();
+  bela::error_code ec;
+  // FILE_SHARE_DELETE lets Compile replace the index while another wsudo has it mapped
+  if (auto fd = bela::io::NewFile(index, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr, ec);
+      fd) {
+    bela::io::MapView view;
+    AliasIndexView iv;
+    if (view.Map(fd->NativeFD(), bela::SizeUnInitialized, ec) && iv.Attach({view.data(), view.size()}, stamp)) {
+      if (auto target = iv.Find(al); target) {
+        return std::make_optional<std::wstring>(target->begin(), target->end());
+      }
+      return std::nullopt;
+    }
+    DbgPrint(L"alias index %s is stale", index);
+  }
+  AliasEngine ae;
+  if (!ae.Initialize()) {
+    DbgPrint(L"unable initialize alias engine");
+    return std::nullopt;
+  }
+  ae.Compile(stamp);
+  return ae.Target(al);
+}
+
 int wsudo::AliasSubcmd(const std::vector<std::wstring> &argv) {
   if (argv.size() < 2) {
     bela::FPrintF(stderr, L"\x1b[31mwsudo alias missing argument, current have: %d\x1b[0m\n", argv.size());
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <bela/codecvt.hpp>
 #include <bela/simulator.hpp>
+#include "aliasindex.hpp"
 
 namespace wsudo {
 struct AliasTarget {
@@ -44,12 +45,17 @@ public:
   }
   /// prevent apply
   void Prevent() { updated = false; }
+  /// Compile writes wsudo-alias.index for the Privexec.json identified by stamp
+  bool Compile(const AliasStamp &stamp);
 
 private:
   bool updated{false};
   bool Apply();
   value_type alias;
 };
+/// LookupAlias resolves one alias through wsudo-alias.index, one mapping and one probe. A missing or stale index falls
+/// back to parsing Privexec.json and is compiled again.
+std::optional<std::wstring> LookupAlias(std::wstring_view al);
 int AliasSubcmd(const std::vector<std::wstring> &argv);
 } // namespace wsudo
 